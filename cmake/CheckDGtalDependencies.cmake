@@ -89,6 +89,14 @@ find_package(ZLIB REQUIRED)
 target_link_libraries(DGtal PUBLIC ZLIB::ZLIB)
 set(DGtalLibDependencies ${DGtalLibDependencies} ${ZLIB_LIBRARIES})
 
+# -----------------------------------------------------------------------------
+# Looking for threads (std::thread fallback of parallel loops)
+# -----------------------------------------------------------------------------
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+target_link_libraries(DGtal PUBLIC Threads::Threads)
+set(DGtalLibDependencies ${DGtalLibDependencies} Threads::Threads)
+
 # -----------------------------------------------------------------------------
 # Setting librt dependency on Linux
 # -----------------------------------------------------------------------------
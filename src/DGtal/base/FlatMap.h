@@ -0,0 +1,464 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatMap.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module FlatMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatMap_RECURSES)
+#error Recursive header files inclusion detected in FlatMap.h
+#else // defined(FlatMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatMap_RECURSES
+
+#if !defined FlatMap_h
+/** Prevents repeated inclusion of headers. */
+#define FlatMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatMap
+  /**
+     Description of template class 'FlatMap' <p> \brief Aim:
+     Represents a map key -> data as a vector of pairs (key, data)
+     sorted by key, with the interface of std::map.
+
+     Each element takes the size of its key and of its data, without
+     any node or bucket: the memory usage is much smaller than the one
+     of std::map or std::unordered_map for small keys and data, and
+     the elements are visited contiguously, in the order of the keys.
+     Lookups are binary searches.
+
+     Inserting or erasing one element costs O(n), except at the end
+     (e.g. inserting keys in increasing order, with or without a
+     hint). Hence ranges of elements should be inserted with
+     insert(first, last) or insert_or_assign(first, last), which sort
+     the new elements and merge them in O(n + m log m), and elements
+     should be erased with erase_if, in O(n). The set operations of
+     SetFunctions.h use the order of the keys and are linear merges.
+
+     As for std::vector, inserting or erasing elements invalidates
+     iterators, and the keys should not be modified through iterators
+     (value_type is std::pair<Key, T>, not std::pair<const Key, T>).
+
+     Model of boost::PairAssociativeContainer,
+     boost::UniqueAssociativeContainer,
+     boost::SortedAssociativeContainer and of
+     concepts::CSTLAssociativeContainer.
+
+     @tparam TKey the type of the keys, ordered by \a TCompare.
+     @tparam TData the type of the data associated to each key.
+     @tparam TCompare a strict weak ordering on keys.
+
+     @see CubicalComplex
+  */
+  template < typename TKey, typename TData,
+             typename TCompare = std::less<TKey> >
+  class FlatMap
+  {
+  public:
+    typedef FlatMap<TKey, TData, TCompare>       Self;
+    typedef TKey                                 key_type;
+    typedef TData                                mapped_type;
+    typedef std::pair<TKey, TData>               value_type;
+    typedef TCompare                             key_compare;
+    typedef std::vector<value_type>              Container;
+    typedef typename Container::size_type        size_type;
+    typedef typename Container::difference_type  difference_type;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef value_type*                          pointer;
+    typedef const value_type*                    const_pointer;
+    typedef typename Container::iterator         iterator;
+    typedef typename Container::const_iterator   const_iterator;
+    typedef typename Container::reverse_iterator reverse_iterator;
+    typedef typename Container::const_reverse_iterator const_reverse_iterator;
+
+    /// Compares elements by their keys.
+    class value_compare
+    {
+    public:
+      value_compare( const key_compare & comp ) : myComp( comp ) {}
+      bool operator()( const value_type & a, const value_type & b ) const
+      {
+        return myComp( a.first, b.first );
+      }
+    protected:
+      key_compare myComp;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The map is empty.
+     * @param comp the ordering of the keys.
+     */
+    explicit FlatMap( const key_compare & comp = key_compare() );
+
+    /**
+     * Constructor from a range of pairs (key, data). For equal keys,
+     * the first pair of the range is kept.
+     *
+     * @tparam InputIterator a model of input iterator on value_type.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     * @param comp the ordering of the keys.
+     */
+    template <typename InputIterator>
+    FlatMap( InputIterator first, InputIterator last,
+             const key_compare & comp = key_compare() );
+
+    // ----------------------- Iterators, size --------------------------------
+  public:
+
+    /// @return an iterator on the element with the smallest key.
+    iterator begin();
+    /// @return an iterator after the element with the greatest key.
+    iterator end();
+    /// @return an iterator on the element with the smallest key.
+    const_iterator begin() const;
+    /// @return an iterator after the element with the greatest key.
+    const_iterator end() const;
+    /// @return a reverse iterator on the element with the greatest key.
+    reverse_iterator rbegin();
+    /// @return a reverse iterator before the element with the smallest key.
+    reverse_iterator rend();
+    /// @return a reverse iterator on the element with the greatest key.
+    const_reverse_iterator rbegin() const;
+    /// @return a reverse iterator before the element with the smallest key.
+    const_reverse_iterator rend() const;
+
+    /// @return 'true' iff the map has no element.
+    bool empty() const;
+    /// @return the number of elements.
+    size_type size() const;
+    /// @return the maximal number of elements.
+    size_type max_size() const;
+    /// @return the number of elements that fit in the allocated storage.
+    size_type capacity() const;
+
+    /**
+     * Allocates the storage for \a n elements.
+     * @param n a number of elements.
+     */
+    void reserve( size_type n );
+
+    /// Frees the storage that is not used.
+    void shrink_to_fit();
+
+    /// @return the ordering of the keys.
+    key_compare key_comp() const;
+    /// @return the ordering of the elements, by keys.
+    value_compare value_comp() const;
+
+    /**
+     * @return a const reference on the vector of pairs (key, data),
+     * sorted by key.
+     */
+    const Container & container() const;
+
+    // ----------------------- Lookup -----------------------------------------
+  public:
+
+    /**
+     * @param key any key.
+     * @return an iterator on the element with key \a key, or end().
+     */
+    iterator find( const key_type & key );
+    /**
+     * @param key any key.
+     * @return an iterator on the element with key \a key, or end().
+     */
+    const_iterator find( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return 1 if there is an element with key \a key, 0 otherwise.
+     */
+    size_type count( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return an iterator on the first element whose key is not less
+     * than \a key.
+     */
+    iterator lower_bound( const key_type & key );
+    /**
+     * @param key any key.
+     * @return an iterator on the first element whose key is not less
+     * than \a key.
+     */
+    const_iterator lower_bound( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return an iterator on the first element whose key is greater
+     * than \a key.
+     */
+    iterator upper_bound( const key_type & key );
+    /**
+     * @param key any key.
+     * @return an iterator on the first element whose key is greater
+     * than \a key.
+     */
+    const_iterator upper_bound( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return the range of the elements with key \a key (empty or one element).
+     */
+    std::pair<iterator, iterator> equal_range( const key_type & key );
+    /**
+     * @param key any key.
+     * @return the range of the elements with key \a key (empty or one element).
+     */
+    std::pair<const_iterator, const_iterator>
+    equal_range( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return a reference on the data associated to \a key, which is
+     * inserted with a default data if it was not in the map.
+     */
+    mapped_type & operator[]( const key_type & key );
+
+    /**
+     * @param key a key of the map.
+     * @return a reference on the data associated to \a key.
+     * @throw std::out_of_range if \a key is not in the map.
+     */
+    mapped_type & at( const key_type & key );
+    /**
+     * @param key a key of the map.
+     * @return a const reference on the data associated to \a key.
+     * @throw std::out_of_range if \a key is not in the map.
+     */
+    const mapped_type & at( const key_type & key ) const;
+
+    // ----------------------- Modifiers --------------------------------------
+  public:
+
+    /**
+     * Inserts a pair (key, data) if its key is not in the map.
+     *
+     * @param value any pair (key, data).
+     * @return an iterator on the element with this key, and 'true' if
+     * \a value was inserted.
+     */
+    std::pair<iterator, bool> insert( const value_type & value );
+
+    /**
+     * Inserts a pair (key, data) if its key is not in the map. This
+     * is in amortized constant time when \a value is to be inserted
+     * just before \a hint, in particular at end() for increasing keys.
+     *
+     * @param hint an iterator in this map.
+     * @param value any pair (key, data).
+     * @return an iterator on the element with this key.
+     */
+    iterator insert( const_iterator hint, const value_type & value );
+
+    /**
+     * Inserts the pairs (key, data) of a range whose keys are not in
+     * the map. For equal keys, the first pair of the range is
+     * inserted. The new elements are sorted then merged with the map,
+     * in O(n + m log m) for m new elements.
+     *
+     * @tparam InputIterator a model of input iterator on value_type.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Associates \a data to \a key, inserting \a key if it was not in
+     * the map.
+     *
+     * @param key any key.
+     * @param data any data.
+     * @return an iterator on the element with key \a key, and 'true'
+     * if it was inserted.
+     */
+    std::pair<iterator, bool>
+    insert_or_assign( const key_type & key, const mapped_type & data );
+
+    /**
+     * Inserts the pairs (key, data) of a range, replacing the data of
+     * the keys already in the map. For equal keys, the last pair of
+     * the range is kept. The new elements are sorted then merged with
+     * the map, in O(n + m log m) for m new elements.
+     *
+     * @tparam InputIterator a model of input iterator on value_type.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template <typename InputIterator>
+    void insert_or_assign( InputIterator first, InputIterator last );
+
+    /**
+     * Erases the element pointed by \a it.
+     * @param it an iterator on an element of this map.
+     * @return an iterator on the element that followed \a it.
+     */
+    iterator erase( const_iterator it );
+
+    /**
+     * Erases the elements of a range.
+     * @param first the beginning of a range of this map.
+     * @param last the end of a range of this map.
+     * @return an iterator on the element that followed the range.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /**
+     * Erases the element with key \a key, if any.
+     * @param key any key.
+     * @return the number of erased elements (0 or 1).
+     */
+    size_type erase( const key_type & key );
+
+    /**
+     * Erases all the elements that satisfy a predicate, in one pass.
+     *
+     * @tparam Predicate a model of predicate on value_type.
+     * @param pred the predicate, called once per element, in increasing
+     * order of keys.
+     * @return the number of erased elements.
+     */
+    template <typename Predicate>
+    size_type erase_if( Predicate pred );
+
+    /// Erases all the elements.
+    void clear();
+
+    /**
+     * Swaps the content of this map with \a other.
+     * @param other any other map.
+     */
+    void swap( Self & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the keys are sorted and unique.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The pairs (key, data), sorted by key.
+    Container myElements;
+    /// The ordering of the keys.
+    key_compare myComp;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /**
+     * Sorts a vector of new elements, keeps one element per key and
+     * merges them with the elements of this map.
+     *
+     * @param elements the new elements, modified.
+     * @param assign when 'true', the data of the new elements replace
+     * the data of the elements of the map and the last element of
+     * each key is kept, otherwise the first one.
+     */
+    void merge( Container & elements, bool assign );
+
+  }; // end of class FlatMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKey, typename TData, typename TCompare>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatMap<TKey, TData, TCompare> & object );
+
+  /**
+   * @param m1 a map.
+   * @param m2 another map.
+   * @return 'true' iff they have the same elements.
+   */
+  template <typename TKey, typename TData, typename TCompare>
+  bool
+  operator== ( const FlatMap<TKey, TData, TCompare> & m1,
+               const FlatMap<TKey, TData, TCompare> & m2 );
+
+  /**
+   * @param m1 a map.
+   * @param m2 another map.
+   * @return 'true' iff they do not have the same elements.
+   */
+  template <typename TKey, typename TData, typename TCompare>
+  bool
+  operator!= ( const FlatMap<TKey, TData, TCompare> & m1,
+               const FlatMap<TKey, TData, TCompare> & m2 );
+
+  /// FlatMap is a sorted pair associative container with unique keys.
+  template <typename TKey, typename TData, typename TCompare>
+  struct ContainerTraits< FlatMap<TKey, TData, TCompare> >
+  {
+    typedef MapAssociativeCategory Category;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/FlatMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatMap_h
+
+#undef FlatMap_RECURSES
+#endif // else defined(FlatMap_RECURSES)
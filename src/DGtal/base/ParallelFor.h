@@ -0,0 +1,112 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelFor.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for parallel loops over index ranges.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelFor_RECURSES)
+#error Recursive header files inclusion detected in ParallelFor.h
+#else // defined(ParallelFor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelFor_RECURSES
+
+#if !defined ParallelFor_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelFor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <algorithm>
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functions
+  {
+
+    /**
+     * @return the number of threads used by default by
+     * parallelFor, i.e. the maximal number of OpenMP threads if DGtal
+     * has been built with OpenMP support (WITH_OPENMP flag set to
+     * "true"), the number of hardware threads otherwise (at least 1).
+     */
+    inline
+    unsigned int parallelNbThreads();
+
+    /**
+     * Calls @a f( i ) for each index i of [ @a begin, @a end ), in
+     * parallel. The indices are dynamically scheduled by chunks of
+     * consecutive indices, so that @a f may have different costs for
+     * different indices.
+     *
+     * If DGtal has been built with OpenMP support (WITH_OPENMP flag
+     * set to "true"), the loop is an OpenMP parallel for loop,
+     * otherwise it is distributed over a pool of std::thread.
+     *
+     * @code
+     * std::vector<double> v( n );
+     * functions::parallelFor( 0, n, [&] ( std::size_t i ) { v[ i ] = f( i ); } );
+     * @endcode
+     *
+     * @note @a f must be callable concurrently for different
+     * indices. Exceptions must not escape from @a f.
+     *
+     * @param begin the first index.
+     * @param end the index after the last one.
+     * @param f any functor taking a std::size_t.
+     * @param nbThreads the maximal number of threads, 0 (default) means parallelNbThreads().
+     * @param chunkSize the number of consecutive indices processed by a thread at once.
+     *
+     * @tparam TFunction the type of @a f.
+     */
+    template <typename TFunction>
+    inline
+    void parallelFor( std::size_t begin, std::size_t end, TFunction f,
+                      unsigned int nbThreads = 0, std::size_t chunkSize = 1 );
+
+  } // namespace functions
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ParallelFor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelFor_h
+
+#undef ParallelFor_RECURSES
+#endif // else defined(ParallelFor_RECURSES)
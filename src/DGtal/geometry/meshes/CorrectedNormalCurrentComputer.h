@@ -41,10 +41,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
 #include "DGtal/geometry/meshes/SurfaceMeshMeasure.h"
 #include "DGtal/geometry/meshes/CorrectedNormalCurrentFormula.h"
 #include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshFaceGrid.h"
 
 
 namespace DGtal
@@ -79,6 +81,7 @@ namespace DGtal
     typedef CorrectedNormalCurrentFormula< RealPoint, RealVector > Formula;
     typedef SurfaceMeshMeasure< RealPoint, RealVector, Scalar >     ScalarMeasure;
     typedef SurfaceMeshMeasure< RealPoint, RealVector, RealTensor > TensorMeasure;
+    typedef SurfaceMeshFaceGrid< RealPoint, RealVector > FaceGrid;
     typedef std::vector< Scalar >                        Scalars;
     typedef std::vector< RealPoint >                     RealPoints;
     typedef std::vector< RealVector >                    RealVectors;
@@ -114,6 +117,24 @@ namespace DGtal
     /// i.e. the anisotropic tensor curvature measure.
     TensorMeasure computeMuXY() const;
 
+    /// Computes the \f$ \mu_0, \mu_1, \mu_2, \mu^{X,Y} \f$ corrected
+    /// curvature measures of the balls of radius \a r centered on the
+    /// centroids of all the faces. The cells in the balls are found
+    /// with a SurfaceMeshFaceGrid and the faces are processed in
+    /// parallel.
+    ///
+    /// @param r the radius of the balls.
+    /// @param nbThreads the number of threads, 0 for all the available ones.
+    ///
+    /// @return the four ranges of measures, indexed by the faces.
+    ///
+    /// @note The measure of face \a f is the one given by
+    /// `mu.measure( x, r, f )` with `x` the centroid of \a f,
+    /// as long as the part of the mesh in the ball is connected (see
+    /// SurfaceMeshFaceGrid).
+    std::tuple< Scalars, Scalars, Scalars, RealTensors >
+    computeMeasuresInBalls( Scalar r, unsigned int nbThreads = 0 ) const;
+
     //-------------------------------------------------------------------------
   public:
     /// @name Formulas for estimating curvatures from measures
@@ -43,6 +43,7 @@
 #include <vector>
 #include "DGtal/kernel/CCommutativeRing.h"
 #include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshFaceGrid.h"
 
 namespace DGtal
 {
@@ -93,6 +94,7 @@ namespace DGtal
     // 0.
     // BOOST_CONCEPT_ASSERT(( concepts::CCommutativeRing< Value > ));
     typedef DGtal::SurfaceMesh< RealPoint, RealVector > SurfaceMesh;
+    typedef SurfaceMeshFaceGrid< RealPoint, RealVector > FaceGrid;
     typedef typename SurfaceMesh::Index    Index;
     typedef typename SurfaceMesh::Size     Size;
     typedef typename SurfaceMesh::Vertex   Vertex;
@@ -185,12 +187,43 @@ namespace DGtal
         {
           std::tuple< Vertices, WeightedEdges, WeightedFaces >
             wcells = myMeshPtr->computeCellsInclusionsInBall( r, f, x );
-          Value m = vertexMeasure( std::get< 0 >( wcells ) );
-          m      += edgeMeasure  ( std::get< 1 >( wcells ) );
-          m      += faceMeasure  ( std::get< 2 >( wcells ) );
-          return m;
+          return measure( std::get< 0 >( wcells ), std::get< 1 >( wcells ),
+                          std::get< 2 >( wcells ) );
         }
     }
+
+    /// Computes the total measure on the ball of center \a x and
+    /// radius \a r, the cells in the ball being given by a grid over
+    /// the faces of the mesh.
+    ///
+    /// @param x the position where the ball is centered.
+    /// @param r the radius of the ball.
+    /// @param grid a valid grid over the faces of the mesh of this measure.
+    ///
+    /// @note All the cells in the ball are counted, even those that
+    /// are not connected to \a x within the ball (see SurfaceMeshFaceGrid).
+    Value measure( const RealPoint& x, Scalar r, const FaceGrid& grid ) const
+    {
+      if ( vertex_measures.empty() && edge_measures.empty() )
+        return faceMeasure( grid.computeFacesInclusionsInBall( r, x ) );
+      std::tuple< Vertices, WeightedEdges, WeightedFaces >
+        wcells = grid.computeCellsInclusionsInBall( r, x );
+      return measure( std::get< 0 >( wcells ), std::get< 1 >( wcells ),
+                      std::get< 2 >( wcells ) );
+    }
+
+    /// @param vertices any range of (valid) vertex indices.
+    /// @param wedges any range of weighted (valid) edge indices.
+    /// @param wfaces any range of weighted (valid) face indices.
+    /// @return the measure of these cells.
+    Value measure( const Vertices& vertices, const WeightedEdges& wedges,
+                   const WeightedFaces& wfaces ) const
+    {
+      Value m = vertexMeasure( vertices );
+      m      += edgeMeasure  ( wedges );
+      m      += faceMeasure  ( wfaces );
+      return m;
+    }
       
     /// @param v any vertex index.
     /// @return its measure.
@@ -45,6 +45,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/math/linalg/SimpleMatrix.h"
@@ -54,11 +55,100 @@
 #include "DGtal/topology/CCellFunctor.h"
 #include "DGtal/topology/CanonicSCellEmbedder.h"
 #include "DGtal/topology/SCellsFunctors.h"
+#include "DGtal/images/Morton.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+namespace detail
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelBatches
+  /**
+   * Description of class 'SurfelBatches' <p>
+   *
+   * Aim: Splits a range of surfels into batches of spatially coherent
+   * surfels, so that DigitalSurfaceConvolver evaluates the batches in
+   * parallel while reusing, inside each batch, the result of the
+   * previous surfel through the shifting masks.
+   *
+   * The surfels are kept in the given order if it is coherent (e.g. a
+   * depth-first traversal), otherwise they are sorted along the Morton
+   * order of their inner spels, whichever has fewer jumps between
+   * non-adjacent inner spels. This sequence is then cut into a few
+   * contiguous batches per thread. With one thread, there is a single
+   * batch, which keeps the given order.
+   *
+   * @tparam TKSpace space in which the surfels are defined.
+   */
+  template< typename TKSpace >
+  class SurfelBatches
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::Point Point;
+
+    /// Minimal number of surfels of a batch.
+    static const std::size_t minBatchSize = 256;
+
+    /**
+    * Constructor.
+    *
+    * @param[in] K space in which the surfels are defined.
+    * @param[in] surfels the surfels.
+    * @param[in] nbThreads the number of threads, 0 means functions::parallelNbThreads().
+    */
+    SurfelBatches ( const KSpace & K, const std::vector< Surfel > & surfels, unsigned int nbThreads );
+
+    /// @return the number of batches.
+    std::size_t size () const
+    {
+      return myBounds.size() - 1;
+    }
+
+    /// @param[in] b a batch.
+    /// @return the position of the first surfel of batch @a b.
+    std::size_t begin ( std::size_t b ) const
+    {
+      return myBounds[ b ];
+    }
+
+    /// @param[in] b a batch.
+    /// @return the position after the last surfel of batch @a b.
+    std::size_t end ( std::size_t b ) const
+    {
+      return myBounds[ b + 1 ];
+    }
+
+    /// @param[in] k a position in [ begin( b ), end( b ) ).
+    /// @return the index of the k-th surfel in the given range.
+    std::size_t index ( std::size_t k ) const
+    {
+      return myOrder[ k ];
+    }
+
+    /// @return the number of threads.
+    unsigned int nbThreads () const
+    {
+      return myNbThreads;
+    }
+
+  private:
+    unsigned int myNbThreads; ///< Number of threads
+    std::vector< std::size_t > myOrder; ///< Indices of the surfels, batch after batch
+    std::vector< std::size_t > myBounds; ///< Batch b is myOrder[ myBounds[ b ], myBounds[ b + 1 ] )
+
+    /**
+    * @param[in] spels a sequence of spels.
+    * @param[in] order an order on the sequence.
+    * @return the number of consecutive spels in this order that are not adjacent.
+    */
+    static std::size_t nbJumps ( const std::vector< Point > & spels, const std::vector< std::size_t > & order );
+  }; // end of class SurfelBatches
+} // namespace detail
+
 /////////////////////////////////////////////////////////////////////////////
 // template class DigitalSurfaceConvolver
 /**
@@ -67,6 +157,11 @@ namespace DGtal
    * Aim: Compute a convolution between a border on a nD-shape and a convolution kernel : (f*g)(t).
    * An optimization is available when you convolve your shape on adjacent cells using eval(itbegin, itend, output)
    *
+   * The range versions of eval and evalCovarianceMatrix split the
+   * surfels into spatially coherent batches (see detail::SurfelBatches),
+   * which may be processed in parallel (see setNbThreads), each batch
+   * reusing the results of its previous cell.
+   *
    * @tparam TFunctor a model of a functor for the shape to convolve ( f(x) ).
    * @tparam TKernelFunctor a model of a functor for the convolution kernel ( g(x) ).
    * @tparam TKSpace space in which the shape is defined.
@@ -167,6 +262,19 @@ public:
               ConstAlias< DigitalKernel > fullKernel,
               ConstAlias< std::vector< PairIterators > > masks );
 
+  /**
+  * Sets the maximal number of threads used by the eval and
+  * evalCovarianceMatrix methods on a range of surfels.
+  *
+  * @param[in] nbThreads the number of threads, 1 (default) for a
+  * sequential evaluation, 0 means functions::parallelNbThreads(). With
+  * several threads, the shape and kernel functors are called concurrently.
+  */
+  void setNbThreads ( unsigned int nbThreads )
+  {
+    myNbThreads = nbThreads;
+  }
+
   /**
   * Convolve the kernel at a position \a it.
   *
@@ -411,6 +519,8 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  unsigned int myNbThreads; ///< Maximal number of threads of the range evaluations (1: default).
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
@@ -532,6 +642,19 @@ public:
               ConstAlias< DigitalKernel > fullKernel,
               ConstAlias< std::vector< PairIterators > > masks );
 
+  /**
+  * Sets the maximal number of threads used by the eval and
+  * evalCovarianceMatrix methods on a range of surfels.
+  *
+  * @param[in] nbThreads the number of threads, 1 (default) for a
+  * sequential evaluation, 0 means functions::parallelNbThreads(). With
+  * several threads, the shape and kernel functors are called concurrently.
+  */
+  void setNbThreads ( unsigned int nbThreads )
+  {
+    myNbThreads = nbThreads;
+  }
+
   /**
   * Convolve the kernel at a position \a it.
   *
@@ -778,6 +901,8 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  unsigned int myNbThreads; ///< Maximal number of threads of the range evaluations (1: default).
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
@@ -902,6 +1027,19 @@ public:
               ConstAlias< DigitalKernel > fullKernel,
               ConstAlias< std::vector< PairIterators > > masks );
 
+  /**
+  * Sets the maximal number of threads used by the eval and
+  * evalCovarianceMatrix methods on a range of surfels.
+  *
+  * @param[in] nbThreads the number of threads, 1 (default) for a
+  * sequential evaluation, 0 means functions::parallelNbThreads(). With
+  * several threads, the shape and kernel functors are called concurrently.
+  */
+  void setNbThreads ( unsigned int nbThreads )
+  {
+    myNbThreads = nbThreads;
+  }
+
   /**
   * Convolve the kernel at a position \a it.
   *
@@ -1148,6 +1286,8 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  unsigned int myNbThreads; ///< Maximal number of threads of the range evaluations (1: default).
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
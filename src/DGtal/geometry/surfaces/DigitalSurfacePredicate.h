@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/UnorderedSetByBlock.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -55,7 +56,14 @@ namespace DGtal
    * \brief Aim: A point predicate which tells whether a point belongs to the
    * set of pointels of a given digital surface or not.
    *
-   * Internally the set of pointels is stored in a DGtal::UnorderedSetByBlock.
+   * Internally the set of pointels is stored in a dense bitmap over
+   * their bounding box, so that a query is a few integer operations
+   * and a memory access. When this bitmap would take more than 128
+   * bytes per surfel (e.g. a small surface in a very large space), the
+   * pointels are stored in a DGtal::UnorderedSetByBlock instead.
+   *
+   * The predicate is read-only once built, hence it may be queried
+   * concurrently by several threads.
    *
    * @tparam TSurface any digital surface type.
    *
@@ -129,13 +137,22 @@ namespace DGtal
      */
     bool isValid() const;
 
+    /**
+     * @return 'true' if the pointels are stored in a dense bitmap,
+     * 'false' if they are stored in a set.
+     */
+    bool isDense() const;
+
     // ------------------------- Protected Datas ------------------------------
   protected:
 
     // ------------------------- Private Datas --------------------------------
   private:
     CountedConstPtrOrConstPtr<Surface> mySurface; /**< A pointer on the digital surface. */
-    UnorderedSetByBlock<Point> myPointSet; /**< The set of pointels. */
+    UnorderedSetByBlock<Point> myPointSet; /**< The set of pointels, when the bitmap is not used. */
+    std::vector<DGtal::uint64_t> myBits; /**< The bitmap of pointels over their bounding box, possibly empty. */
+    Point myLowerBound; /**< The lowest point of the bounding box of the bitmap. */
+    Point myExtent; /**< The number of points of the bounding box of the bitmap along each axis. */
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -148,7 +165,8 @@ namespace DGtal
     KSpace const& space () const;
 
     /**
-     * Computes the set of pointels, fills the myPointSet object.
+     * Computes the set of pointels, fills either the bitmap or the
+     * myPointSet object.
      */
     void buildPointSet();
 
@@ -0,0 +1,380 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceSweepConvolver.h
+ * @brief Computes the convolution of a shape with a digital kernel at
+ * all the surfels of a range at once, by sweeping the shape with
+ * summed row tables.
+ *
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h IntegralInvariantVolumeEstimator.h IntegralInvariantCovarianceEstimator.h
+ */
+
+#if defined(DigitalSurfaceSweepConvolver_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceSweepConvolver.h
+#else // defined(DigitalSurfaceSweepConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceSweepConvolver_RECURSES
+
+#if !defined DigitalSurfaceSweepConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceSweepConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * The convolution engines of IntegralInvariantVolumeEstimator and
+   * IntegralInvariantCovarianceEstimator.
+   *
+   * - Masks: DigitalSurfaceConvolver, the kernel is moved from surfel
+   *   to surfel, and only the difference between the kernels of two
+   *   adjacent spels is visited (fast for surfels given in a
+   *   depth-first order and small radii).
+   * - Sweep: DigitalSurfaceSweepConvolver, all the surfels are computed
+   *   at once with summed row tables (fast for large radii and any
+   *   order of surfels).
+   */
+  enum class IIConvolutionEngine { Masks, Sweep };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfaceSweepConvolver
+  /**
+   * Description of template class 'DigitalSurfaceSweepConvolver' <p>
+   * \brief Aim: Computes, for all the surfels of a range at once, the
+   * convolution of a shape with a digital kernel (the number of shape
+   * points in the kernel) or the covariance matrix of the shape points
+   * in the kernel, as DigitalSurfaceConvolver does.
+   *
+   * As in DigitalSurfaceConvolver, the value at a surfel is the mean of
+   * the values at its inner and outer spels. The kernel is stored as
+   * intervals along the first axis, and the shape is swept along the
+   * last axis: only the slices of the shape close to the current slice
+   * of spels are kept, as prefix sums along the first axis of the
+   * characteristic function (and of its first and second moments for
+   * the covariance matrices). The value at a spel is then obtained
+   * with one subtraction per kernel interval, i.e. in O(r^(d-1)) instead
+   * of O(r^d) for a ball kernel of radius r. Each slice of the shape is
+   * read once, and the slices and spels may be processed in parallel
+   * (see setNbThreads).
+   *
+   * Several nested kernels (e.g. concentric balls of increasing radii)
+   * may be given to initMultiscale(). The kernel intervals are then
+   * split into shells (the points of a kernel that are not in the
+   * previous ones), and evalMultiscale() gives, in one sweep, the
+   * convolution at each surfel for every kernel, as prefix sums of the
+   * shell convolutions.
+   *
+   * @note With several threads, the point predicate is called concurrently.
+   *
+   * @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
+   * in which the shape is defined.
+   * @tparam TPointPredicate a model of concepts::CPointPredicate, the
+   * characteristic function of the shape.
+   *
+   * @see IntegralInvariantVolumeEstimator, IntegralInvariantCovarianceEstimator
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  class DigitalSurfaceSweepConvolver
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef DigitalSurfaceSweepConvolver<TKSpace, TPointPredicate> Self;
+    typedef TKSpace KSpace;
+    typedef TPointPredicate PointPredicate;
+
+    BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+    BOOST_CONCEPT_ASSERT (( concepts::CPointPredicate< PointPredicate > ));
+
+    typedef typename KSpace::Space Space;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename KSpace::SCell Spel;
+    typedef typename KSpace::Surfel Surfel;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = KSpace::dimension );
+    BOOST_STATIC_ASSERT(( dimension >= 2 ));
+
+    typedef double Quantity;
+    typedef SimpleMatrix< double, dimension, dimension > CovarianceMatrix;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object is not valid until init() is called.
+     *
+     * @param[in] K the cellular grid space in which the shape is defined.
+     * @param[in] aPointPredicate the characteristic function of the shape.
+     * @param[in] nbThreads the maximal number of threads, 1 (default)
+     * for a sequential evaluation, 0 means functions::parallelNbThreads().
+     */
+    DigitalSurfaceSweepConvolver( ConstAlias< KSpace > K,
+                                  ConstAlias< PointPredicate > aPointPredicate,
+                                  unsigned int nbThreads = 1 );
+
+    /**
+     * Initializes the kernel.
+     *
+     * @tparam TDigitalKernel a digital shape centered on the origin,
+     * with a getDomain() method and an operator() Point -> bool (e.g.
+     * GaussDigitizer).
+     * @param[in] aKernel the kernel.
+     */
+    template <typename TDigitalKernel>
+    void init( const TDigitalKernel & aKernel );
+
+    /**
+     * Initializes several nested kernels, for evalMultiscale(). The
+     * other evaluation methods then use the last (largest) kernel.
+     *
+     * @tparam TDigitalKernel a digital shape centered on the origin,
+     * with a getDomain() method and an operator() Point -> bool (e.g.
+     * GaussDigitizer).
+     * @param[in] kernels the kernels, each one included in the next one.
+     */
+    template <typename TDigitalKernel>
+    void initMultiscale( const std::vector< TDigitalKernel > & kernels );
+
+    /**
+     * Sets the maximal number of threads.
+     *
+     * @param[in] nbThreads the number of threads, 0 means
+     * functions::parallelNbThreads(). With several threads, the point
+     * predicate is called concurrently.
+     */
+    void setNbThreads( unsigned int nbThreads )
+    {
+      myNbThreads = nbThreads;
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the convolution at each surfel of [itbegin,itend), and
+     * writes functor( value ) on result. Only the last kernel is used
+     * after initMultiscale().
+     *
+     * @tparam SurfelIterator a model of forward iterator on surfels.
+     * @tparam OutputIterator a model of output iterator.
+     * @tparam EvalFunctor a functor Quantity -> OutputIterator::value_type.
+     *
+     * @param[in] itbegin the first surfel.
+     * @param[in] itend after the last surfel.
+     * @param[in,out] result the output iterator.
+     * @param[in] functor the functor applied to the convolution values.
+     */
+    template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+    void eval( const SurfelIterator & itbegin,
+               const SurfelIterator & itend,
+               OutputIterator & result,
+               EvalFunctor functor ) const;
+
+    /**
+     * Computes the convolution at each surfel of [itbegin,itend) for
+     * each kernel given to initMultiscale(), and writes, for each
+     * surfel, the vector of the functors[ k ]( value of kernel k ) on
+     * result.
+     *
+     * @tparam SurfelIterator a model of forward iterator on surfels.
+     * @tparam OutputIterator a model of output iterator on
+     * std::vector< EvalFunctor::Value >.
+     * @tparam EvalFunctor a functor Quantity -> EvalFunctor::Value.
+     *
+     * @param[in] itbegin the first surfel.
+     * @param[in] itend after the last surfel.
+     * @param[in,out] result the output iterator.
+     * @param[in] functors one functor per kernel.
+     */
+    template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+    void evalMultiscale( const SurfelIterator & itbegin,
+                         const SurfelIterator & itend,
+                         OutputIterator & result,
+                         const std::vector< EvalFunctor > & functors ) const;
+
+    /**
+     * Computes the covariance matrix at each surfel of
+     * [itbegin,itend), and writes functor( matrix ) on result.
+     * Only the last kernel is used after initMultiscale().
+     *
+     * @tparam SurfelIterator a model of forward iterator on surfels.
+     * @tparam OutputIterator a model of output iterator.
+     * @tparam EvalFunctor a functor CovarianceMatrix -> OutputIterator::value_type.
+     *
+     * @param[in] itbegin the first surfel.
+     * @param[in] itend after the last surfel.
+     * @param[in,out] result the output iterator.
+     * @param[in] functor the functor applied to the covariance matrices.
+     */
+    template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+    void evalCovarianceMatrix( const SurfelIterator & itbegin,
+                               const SurfelIterator & itend,
+                               OutputIterator & result,
+                               EvalFunctor functor ) const;
+
+    /**
+     * @return the number of intervals of the kernel.
+     */
+    std::size_t nbKernelIntervals() const
+    {
+      return myIntervals.size();
+    }
+
+    /**
+     * @return the number of kernels (1 after init()).
+     */
+    std::size_t nbKernels() const
+    {
+      return myNbShells;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// An interval of the kernel along the first axis.
+    struct KernelInterval
+    {
+      /// Position of the interval (first coordinate is 0)
+      Point offset;
+      /// First coordinate of the interval
+      Integer first;
+      /// Last coordinate of the interval
+      Integer last;
+      /// Index of the first kernel containing the interval
+      std::size_t shell;
+    };
+
+    /// The cellular grid space
+    CountedConstPtrOrConstPtr< KSpace > myKSpace;
+    /// The characteristic function of the shape
+    CountedConstPtrOrConstPtr< PointPredicate > myPointPredicate;
+    /// Maximal number of threads
+    unsigned int myNbThreads;
+    /// The kernel, as intervals along the first axis
+    std::vector< KernelInterval > myIntervals;
+    /// Extent of the kernel along the last axis
+    Integer myLastRadius;
+    /// Number of nested kernels
+    std::size_t myNbShells;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the inner and outer spels of the surfels.
+     *
+     * @param[in] itbegin the first surfel.
+     * @param[in] itend after the last surfel.
+     * @param[out] surfelSpels the inner and outer spels of each surfel, in order.
+     * @param[out] spels the distinct spels, sorted along the sweep order.
+     */
+    template< typename SurfelIterator >
+    void getSpels( const SurfelIterator & itbegin,
+                   const SurfelIterator & itend,
+                   std::vector< Point > & surfelSpels,
+                   std::vector< Point > & spels ) const;
+
+    /**
+     * Sweeps the shape and computes the convolution (and the
+     * covariance matrices) at the given spels.
+     *
+     * @param[in] spels the spels, sorted along the sweep order.
+     * @param[in] withMoments when 'true', computes the covariance matrices.
+     * @param[out] volumes the convolution at each spel, for each kernel
+     * (nbKernels() values per spel).
+     * @param[out] matrices the covariance matrix at each spel (if withMoments).
+     */
+    void sweep( const std::vector< Point > & spels, bool withMoments,
+                std::vector< Quantity > & volumes,
+                std::vector< CovarianceMatrix > & matrices ) const;
+
+    /**
+     * @param[in] spels the spels, sorted along the sweep order.
+     * @param[in] p a spel of spels.
+     * @return the index of p in spels.
+     */
+    static std::size_t indexOf( const std::vector< Point > & spels, const Point & p );
+
+    /**
+     * Sweep order: lexicographic order from the last coordinate.
+     * @param[in] p a point.
+     * @param[in] q a point.
+     * @return 'true' if p is before q.
+     */
+    static bool sweepLess( const Point & p, const Point & q );
+
+  }; // end of class DigitalSurfaceSweepConvolver
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceSweepConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfaceSweepConvolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSurfaceSweepConvolver<TKSpace, TPointPredicate> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfaceSweepConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceSweepConvolver_h
+
+#undef DigitalSurfaceSweepConvolver_RECURSES
+#endif // else defined(DigitalSurfaceSweepConvolver_RECURSES)
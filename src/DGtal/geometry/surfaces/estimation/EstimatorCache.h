@@ -66,7 +66,7 @@ namespace DGtal
    *
    * This class is also a model of concepts::CSurfelLocalEstimator
    *
-   * @see testEstimatorCache.cpp
+   * @see IndexedEstimatorCache, testEstimatorCache.cpp
 
    * @tparam TEstimator any model of CSurfelLocalEstimator
    * @tparam TContainer the associative container to use (default type: std::map<Surfel,Quantity>)
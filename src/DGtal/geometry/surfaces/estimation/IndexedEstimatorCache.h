@@ -0,0 +1,563 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedEstimatorCache.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module IndexedEstimatorCache.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedEstimatorCache_RECURSES)
+#error Recursive header files inclusion detected in IndexedEstimatorCache.h
+#else // defined(IndexedEstimatorCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedEstimatorCache_RECURSES
+
+#if !defined IndexedEstimatorCache_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedEstimatorCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedEstimatorCache
+  /**
+   * Description of template class 'IndexedEstimatorCache' <p>
+   * \brief Aim: this class adapts any local surface estimator to cache the estimated
+   * values in a vector indexed by the position of the surfels in the
+   * range given at initialization.
+   *
+   * As EstimatorCache, it is useful when the same quantity is
+   * estimated several times, but the values are stored contiguously
+   * and are accessed in O(1), either by index (e.g. the vertex of an
+   * IndexedDigitalSurface whose surfels were given in vertex order)
+   * or by surfel, through an open addressing hash table of indices.
+   *
+   * The cache may be filled in parallel (see setNbThreads) when the
+   * eval method of the estimator may be called concurrently, and may
+   * be saved to (and loaded from) a binary file, so that it can be
+   * reused across runs (see save and load).
+   *
+   * @code
+   * std::vector<Surfel> surfels;
+   * for ( auto v : idx_surface ) surfels.push_back( idx_surface.surfel( v ) );
+   * IndexedEstimatorCache<Estimator> cache( estimator );
+   * cache.setNbThreads( 0 ); // the estimator is thread-safe
+   * cache.init( h, surfels.begin(), surfels.end() );
+   * Quantity q = cache.eval( v ); // value at vertex v
+   * @endcode
+   *
+   * This class is a model of concepts::CSurfelLocalEstimator.
+   *
+   * @see EstimatorCache, testEstimatorCache.cpp
+   *
+   * @tparam TEstimator any model of CSurfelLocalEstimator.
+   */
+  template <typename TEstimator>
+  class IndexedEstimatorCache
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Estimator type
+    typedef TEstimator Estimator;
+    BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<TEstimator> ));
+
+    ///Surfel type
+    typedef typename Estimator::Surfel Surfel;
+
+    ///Quantity type
+    typedef typename Estimator::Quantity Quantity;
+
+    ///Index type (position of a surfel in the initialization range)
+    typedef std::size_t Index;
+
+    ///Container of surfels
+    typedef std::vector<Surfel> SurfelContainer;
+
+    ///Container of cached values
+    typedef std::vector<Quantity> Container;
+
+    ///Self
+    typedef IndexedEstimatorCache<Estimator> Self;
+
+    /**
+     * Default constructor.
+     */
+    IndexedEstimatorCache(): myEstimator( 0 ), myH( 0.0 ), myNbThreads( 1 ), myInit( false )
+    {}
+
+    /**
+     * Constructor from estimator instance.
+     *
+     */
+    IndexedEstimatorCache( Alias<Estimator> anEstimator ): myEstimator( &anEstimator ),
+                                                          myH( 0.0 ),
+                                                          myNbThreads( 1 ),
+                                                          myInit( false )
+    {}
+
+    /**
+     * Sets the number of threads used by init to fill the cache.
+     *
+     * @param nbThreads the maximal number of threads, 1 (default)
+     * means a sequential filling, 0 means functions::parallelNbThreads().
+     *
+     * @pre the eval method of the estimator may be called
+     * concurrently if \a nbThreads is not 1.
+     */
+    void setNbThreads( unsigned int nbThreads )
+    {
+      myNbThreads = nbThreads;
+    }
+
+    // ----------------------- CSurfelLocalEstimator Interface --------------------------------------
+
+    /**
+     * Estimator initialization. This method initializes the underlying
+     * estimator and caches all estimated quantity between @a itb and
+     * @a ite. The index of a surfel is its position in this range.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     *
+     */
+    template <typename SurfelConstIterator>
+    void init(const double aH, SurfelConstIterator itb, SurfelConstIterator ite)
+    {
+      ASSERT(myEstimator);
+      myH = aH;
+      mySurfels.assign( itb, ite );
+      myEstimator->init( aH, mySurfels.cbegin(), mySurfels.cend() );
+      myValues.resize( mySurfels.size() );
+
+      //We estimate and store the quantities, by chunks of surfels.
+      const std::size_t chunk = 256;
+      functions::parallelFor( 0, ( mySurfels.size() + chunk - 1 ) / chunk,
+                              [&] ( std::size_t c )
+        {
+          typename SurfelContainer::const_iterator it = mySurfels.cbegin() + c * chunk;
+          for ( Index i = c * chunk, iE = std::min( i + chunk, mySurfels.size() );
+                i < iE; ++i, ++it )
+            myValues[ i ] = myEstimator->eval( it );
+        }, myNbThreads );
+      buildIndex();
+      myInit = true;
+    }
+
+    /**
+     * Cached evaluation of the estimator at iterator @a it, which
+     * may point either to a surfel or to an index. Integral types are
+     * excluded, so that eval( i ) with any integer @a i is the
+     * evaluation at index @a i.
+     *
+     * @pre init() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels or on indices.
+     * @param [in] it the iterator to the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    template <typename SurfelConstIterator>
+    typename std::enable_if< ! std::is_integral<SurfelConstIterator>::value, Quantity >::type
+    eval(const SurfelConstIterator it) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      return this->eval( *it );
+    }
+
+    /**
+     * Cached evaluation of the estimator at a surfel @a s, in O(1)
+     * on average.
+     *
+     * @pre init() method must have been called first and @a s
+     * belongs to the initialization range.
+     *
+     * @param [in] s the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    Quantity eval(const Surfel s) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      const Index i = index( s );
+      ASSERT( i < myValues.size() );
+      return myValues[ i ];
+    }
+
+    /**
+     * Cached evaluation of the estimator at the surfel of index @a i.
+     *
+     * @pre init() method must have been called first.
+     *
+     * @param [in] i the index of the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    Quantity eval(const Index i) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      ASSERT( i < myValues.size() );
+      return myValues[ i ];
+    }
+
+    /**
+     * Cached range evaluation of the estimator between @a itb
+     * and @a ite.
+     *
+     * @pre init() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels or on indices.
+     * @param [in] itb the begin iterator to the surfel to estimate.
+     * @param [in] ite the end iterator to the surfel to estimate.
+     * @param [in] result an output iterator on the result.
+     * @return the estimated quantity.
+     */
+    template <typename SurfelConstIterator,typename OutputIterator>
+    OutputIterator eval(SurfelConstIterator itb,
+                        SurfelConstIterator ite,
+                        OutputIterator result ) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      for(SurfelConstIterator it = itb; it != ite; ++it)
+        *result++ = this->eval(it);
+
+      return result;
+    }
+
+    /**
+     * @return the gridstep given to init, or read by load (so that
+     * it is also available without estimator).
+     *
+     * @pre init() or load() method must have been called first.
+     */
+    double h() const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      return myH;
+    }
+
+    // ----------------------- Indexed services --------------------------------
+  public:
+
+    /**
+     * @param [in] s any surfel.
+     * @return the index of @a s, or size() if @a s is not cached.
+     */
+    Index index( const Surfel & s ) const
+    {
+      if ( myTable.empty() ) return mySurfels.size();
+      const std::size_t mask = myTable.size() - 1;
+      std::size_t j = myHash( s ) & mask;
+      while ( myTable[ j ] != EMPTY )
+        {
+          if ( mySurfels[ myTable[ j ] ] == s ) return myTable[ j ];
+          j = ( j + 1 ) & mask;
+        }
+      return mySurfels.size();
+    }
+
+    /// @return the cached surfels, in the order of their indices.
+    const SurfelContainer & surfels() const
+    {
+      return mySurfels;
+    }
+
+    /// @return the cached values, in the order of the surfel indices.
+    const Container & values() const
+    {
+      return myValues;
+    }
+
+    /**
+     * Saves the gridstep and the cached surfels and values into a
+     * binary file (in the native byte order).
+     *
+     * @note Quantity must be an arithmetic type or a vector of
+     * arithmetic components with a static 'dimension' (like
+     * PointVector).
+     *
+     * @param [in] filename the name of the file.
+     * @return 'true' if the file was written.
+     */
+    bool save( const std::string & filename ) const
+    {
+      std::ofstream out( filename.c_str(), std::ios::out | std::ios::binary );
+      if ( ! out.good() ) return false;
+      out.write( MAGIC, sizeof( MAGIC ) );
+      writeRaw( out, (DGtal::uint64_t) mySurfels.size() );
+      writeRaw( out, (DGtal::uint32_t) surfelBytes() );
+      writeRaw( out, (DGtal::uint32_t) quantityBytes() );
+      writeRaw( out, myH );
+      for ( Index i = 0; i < mySurfels.size(); ++i )
+        {
+          writeSurfel( out, mySurfels[ i ] );
+          writeQuantity( out, myValues[ i ] );
+        }
+      return out.good();
+    }
+
+    /**
+     * Loads the gridstep and the cached surfels and values from a
+     * file written by save. The cache is then initialized, without
+     * calling the estimator, which may even be missing (default
+     * constructor).
+     *
+     * @tparam TKSpace the type of cellular grid space of the surfels.
+     * @param [in] filename the name of the file.
+     * @param [in] K the space of the surfels.
+     * @return 'true' if the file was read, 'false' if it does not
+     * exist or does not hold a cache of this type (the cache is then
+     * left unchanged).
+     */
+    template <typename TKSpace>
+    bool load( const std::string & filename, const TKSpace & K )
+    {
+      std::ifstream in( filename.c_str(), std::ios::in | std::ios::binary );
+      if ( ! in.good() ) return false;
+      char magic[ sizeof( MAGIC ) ];
+      DGtal::uint64_t n = 0;
+      DGtal::uint32_t sbytes = 0, qbytes = 0;
+      double aH = 0.0;
+      in.read( magic, sizeof( MAGIC ) );
+      readRaw( in, n );
+      readRaw( in, sbytes );
+      readRaw( in, qbytes );
+      readRaw( in, aH );
+      if ( ! in.good() || ! std::equal( magic, magic + sizeof( MAGIC ), MAGIC )
+           || sbytes != surfelBytes() || qbytes != quantityBytes() )
+        return false;
+      // the file must hold n surfels and values
+      const std::streampos start = in.tellg();
+      in.seekg( 0, std::ios::end );
+      const std::streamoff remaining = in.tellg() - start;
+      in.seekg( start );
+      if ( ! in.good() || remaining < 0
+           || n > (DGtal::uint64_t) remaining / ( sbytes + qbytes ) )
+        return false;
+      SurfelContainer surfels( n, Surfel() );
+      Container values( n );
+      for ( Index i = 0; i < n && in.good(); ++i )
+        {
+          readSurfel( in, K, surfels[ i ] );
+          readQuantity( in, values[ i ] );
+        }
+      if ( ! in.good() ) return false;
+      mySurfels.swap( surfels );
+      myValues.swap( values );
+      myH = aH;
+      buildIndex();
+      myInit = true;
+      return true;
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @pre init() method must have been called first.
+     * @return the number of cached elements.
+     */
+    typename Container::size_type size() const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      return myValues.size();
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out<< "[IndexedEstimatorCache] number of surfels="<<myValues.size();
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myEstimator ? myEstimator->isValid() : myInit;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The value of empty slots of the hash table.
+    static constexpr Index EMPTY = ~Index( 0 );
+    /// The signature of cache files.
+    static constexpr char MAGIC[ 12 ] = { 'D', 'G', 't', 'a', 'l', 'E',
+                                          's', 't', 'C', 'a', 'c', 'h' };
+
+    ///The cached surfels
+    SurfelContainer mySurfels;
+
+    ///The cached values
+    Container myValues;
+
+    ///The hash table of surfel indices (its size is 0 or a power of 2).
+    std::vector<Index> myTable;
+
+    ///The hash function of surfels
+    std::hash<Surfel> myHash;
+
+    ///Alias of the estimator
+    Estimator *myEstimator;
+
+    ///The gridstep
+    double myH;
+
+    ///The maximal number of threads used by init
+    unsigned int myNbThreads;
+
+    ///Init flag
+    bool myInit;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Builds the hash table of surfel indices.
+    void buildIndex()
+    {
+      std::size_t nb_slots = 16;
+      while ( nb_slots < 2 * mySurfels.size() ) nb_slots *= 2;
+      myTable.assign( nb_slots, EMPTY );
+      const std::size_t mask = nb_slots - 1;
+      for ( Index i = 0; i < mySurfels.size(); ++i )
+        {
+          std::size_t j = myHash( mySurfels[ i ] ) & mask;
+          while ( myTable[ j ] != EMPTY )
+            {
+              if ( mySurfels[ myTable[ j ] ] == mySurfels[ i ] ) break;
+              j = ( j + 1 ) & mask;
+            }
+          // A surfel given several times keeps its first index.
+          if ( myTable[ j ] == EMPTY ) myTable[ j ] = i;
+        }
+    }
+
+    /// @return the number of bytes of a surfel in a file.
+    static std::size_t surfelBytes()
+    {
+      return Surfel::Point::dimension * sizeof( typename Surfel::Integer ) + 1;
+    }
+
+    /// @return the number of bytes of a quantity in a file.
+    static std::size_t quantityBytes()
+    {
+      if constexpr ( std::is_arithmetic<Quantity>::value )
+        return sizeof( Quantity );
+      else
+        return Quantity::dimension * sizeof( typename Quantity::Component );
+    }
+
+    template <typename T>
+    static void writeRaw( std::ostream & out, const T & v )
+    {
+      out.write( reinterpret_cast<const char*>( &v ), sizeof( T ) );
+    }
+
+    template <typename T>
+    static void readRaw( std::istream & in, T & v )
+    {
+      in.read( reinterpret_cast<char*>( &v ), sizeof( T ) );
+    }
+
+    static void writeSurfel( std::ostream & out, const Surfel & s )
+    {
+      for ( Dimension k = 0; k < Surfel::Point::dimension; ++k )
+        writeRaw( out, s.preCell().coordinates[ k ] );
+      writeRaw( out, (char) ( s.preCell().positive ? 1 : 0 ) );
+    }
+
+    template <typename TKSpace>
+    static void readSurfel( std::istream & in, const TKSpace & K, Surfel & s )
+    {
+      typename Surfel::Point kp;
+      char positive = 0;
+      for ( Dimension k = 0; k < Surfel::Point::dimension; ++k )
+        readRaw( in, kp[ k ] );
+      readRaw( in, positive );
+      s = K.sCell( kp, positive != 0 );
+    }
+
+    static void writeQuantity( std::ostream & out, const Quantity & q )
+    {
+      if constexpr ( std::is_arithmetic<Quantity>::value )
+        writeRaw( out, q );
+      else
+        for ( Dimension k = 0; k < Quantity::dimension; ++k )
+          writeRaw( out, q[ k ] );
+    }
+
+    static void readQuantity( std::istream & in, Quantity & q )
+    {
+      if constexpr ( std::is_arithmetic<Quantity>::value )
+        readRaw( in, q );
+      else
+        for ( Dimension k = 0; k < Quantity::dimension; ++k )
+          readRaw( in, q[ k ] );
+    }
+
+  }; // end of class IndexedEstimatorCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedEstimatorCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedEstimatorCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const IndexedEstimatorCache<T> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} // namespace DGtal
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedEstimatorCache_h
+
+#undef IndexedEstimatorCache_RECURSES
+#endif // else defined(IndexedEstimatorCache_RECURSES)
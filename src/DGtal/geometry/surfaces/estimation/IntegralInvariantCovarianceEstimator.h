@@ -56,6 +56,7 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceSweepConvolver.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
@@ -84,7 +85,10 @@ namespace DGtal
 * confirm the multigrid convergence.
 *
 * Optimization is available when we give a range of 0-adjacent
-* surfels to the estimator. Note that you should use
+* surfels to the estimator. For large radii or unordered ranges of
+* surfels, the IIConvolutionEngine::Sweep engine (see setEngine)
+* computes all the surfels of a range at once in parallel, with
+* DigitalSurfaceSweepConvolver. Note that you should use
 * IntegralInvariantVolumeEstimator instead when trying to estimate the
 * 2D curvature or the mean curvature.
 *
@@ -156,6 +160,7 @@ public:
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, 
                                   KSpace, DigitalShapeKernel> Convolver;
   typedef typename Convolver::PairIterators PairIterators;
+  typedef DigitalSurfaceSweepConvolver< KSpace, PointPredicate > SweepConvolver;
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
   typedef double Scalar;
@@ -235,6 +240,31 @@ public:
   * @param[in] dRadius the "digital" radius of the kernel (but may be non integer).
   */
   void setParams( const double dRadius );
+
+  /**
+  * Selects the convolution engine used by init and eval (default is
+  * IIConvolutionEngine::Masks). Both engines give the same values,
+  * the Sweep engine being faster for large radii and whole ranges of
+  * surfels. The evaluation of a single surfel (eval( it )) always
+  * uses the shifting masks, which init computes for both engines.
+  * Must be called before init.
+  *
+  * @param[in] anEngine the convolution engine.
+  */
+  void setEngine( IIConvolutionEngine anEngine );
+
+  /// @return the convolution engine.
+  IIConvolutionEngine engine() const;
+
+  /**
+  * Sets the maximal number of threads used by eval on a range of
+  * surfels, with both engines. Must be called after attach.
+  *
+  * @param[in] nbThreads the number of threads, 1 (default) for a
+  * sequential evaluation, 0 means functions::parallelNbThreads(). With
+  * several threads, the shape functor is called concurrently.
+  */
+  void setNbThreads( unsigned int nbThreads );
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -256,6 +286,11 @@ public:
   *
   * @tparam SurfelConstIterator type of Iterator on a Surfel
   *
+  * @note A single surfel is convolved with the full kernel (in
+  * O(R^d) operations) and the shifting masks, whatever the engine.
+  * Use the range version to benefit from the shifting masks between
+  * consecutive surfels or from the Sweep engine.
+  *
   * @param[in] it iterator pointing on the surfel of the shape where
   * we wish to evaluate some geometric information.
   *
@@ -316,6 +351,8 @@ private:
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
   CountedPtr<ShapeSpelFunctor>   myShapeSpelFunctor;  ///< Smart pointer on functor spel ->  {0,1}
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
+  CountedPtr<SweepConvolver>     mySweepConvolver; ///< Convolver of the Sweep engine
+  IIConvolutionEngine            myEngine;      ///< Convolution engine
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (but may be non integer).
 
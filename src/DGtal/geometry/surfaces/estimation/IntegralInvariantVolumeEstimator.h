@@ -56,6 +56,7 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceSweepConvolver.h"
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
@@ -84,7 +85,12 @@ namespace DGtal
 * radius.  Experimental results confirm the multigrid convergence.
 *
 * Optimization is available when we give a range of 0-adjacent
-* surfels to the estimator. Note that you should use
+* surfels to the estimator. For large radii or unordered ranges of
+* surfels, the IIConvolutionEngine::Sweep engine (see setEngine)
+* computes all the surfels of a range at once in parallel, with
+* DigitalSurfaceSweepConvolver. Several radii may be given to
+* setParams, evalMultiscale then computes the estimations for all the
+* radii in a single sweep of the shape. Note that you should use
 * IntegralInvariantCovarianceEstimator instead when trying to estimate
 * the normal or principal curvature directions, the Gaussian curvature
 * or individual principal curvature values.
@@ -154,6 +160,7 @@ public:
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, 
                                   KSpace, DigitalShapeKernel> Convolver;
   typedef typename Convolver::PairIterators PairIterators;
+  typedef DigitalSurfaceSweepConvolver< KSpace, PointPredicate > SweepConvolver;
   typedef typename Convolver::CovarianceMatrix Matrix;
   typedef typename Matrix::Component Component;
   typedef double Scalar;
@@ -233,6 +240,40 @@ public:
   * @param[in] dRadius the "digital" radius of the kernel (buy may be non integer).
   */
   void setParams( const double dRadius );
+
+  /**
+  * Set specific parameters: the radii of the balls, for
+  * evalMultiscale. The other evaluation methods use the last
+  * (largest) radius.
+  *
+  * @param[in] dRadii the "digital" radii of the kernels, in increasing order.
+  */
+  void setParams( const std::vector< double > & dRadii );
+
+  /**
+  * Selects the convolution engine used by init and eval (default is
+  * IIConvolutionEngine::Masks). Both engines give the same values,
+  * the Sweep engine being faster for large radii and whole ranges of
+  * surfels. The evaluation of a single surfel (eval( it )) always
+  * uses the shifting masks, which init computes for both engines.
+  * Must be called before init.
+  *
+  * @param[in] anEngine the convolution engine.
+  */
+  void setEngine( IIConvolutionEngine anEngine );
+
+  /// @return the convolution engine.
+  IIConvolutionEngine engine() const;
+
+  /**
+  * Sets the maximal number of threads used by eval on a range of
+  * surfels, with both engines. Must be called after attach.
+  *
+  * @param[in] nbThreads the number of threads, 1 (default) for a
+  * sequential evaluation, 0 means functions::parallelNbThreads(). With
+  * several threads, the shape functor is called concurrently.
+  */
+  void setNbThreads( unsigned int nbThreads );
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -254,6 +295,11 @@ public:
   *
   * @tparam SurfelConstIterator type of Iterator on a Surfel
   *
+  * @note A single surfel is convolved with the full kernel (in
+  * O(R^d) operations) and the shifting masks, whatever the engine.
+  * Use the range version to benefit from the shifting masks between
+  * consecutive surfels or from the Sweep engine.
+  *
   * @param[in] it iterator pointing on the surfel of the shape where
   * we wish to evaluate some geometric information.
   *
@@ -288,6 +334,34 @@ public:
                        SurfelConstIterator ite,
                        OutputIterator result ) const;
 
+  /**
+  * -- Estimation --
+  *
+  * Compute the integral invariant volumes for a range of surfels
+  * [itb,ite) and for each radius given to setParams, then apply the
+  * VolumeFunctor (initialized with each radius). The volumes of all
+  * the radii are obtained in one sweep of the shape with
+  * DigitalSurfaceSweepConvolver, by accumulating the volumes of the
+  * shells between consecutive balls, whatever the engine.
+  *
+  * @tparam OutputIterator type of Iterator of an array of std::vector<Quantity>
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  *
+  * @param[in] itb iterator defining the start of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] ite iterator defining the end of the range of surfels
+  * where we wish to compute some geometric information.
+  *
+  * @param[in] result output iterator of results of the computation:
+  * for each surfel, the vector of the quantities for each radius.
+  * @return the updated output iterator after all outputs.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator evalMultiscale( SurfelConstIterator itb,
+                                 SurfelConstIterator ite,
+                                 OutputIterator result ) const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -304,6 +378,7 @@ public:
 private:
 
   VolumeFunctor myFct;            ///< The volume functor that transforms the volume into a quantity.
+  std::vector< VolumeFunctor > myFcts; ///< The volume functors of each radius (evalMultiscale).
   const KernelSpelFunctor myKernelFunctor;  ///< Kernel functor (on Spel)
   std::vector< PairIterators > myKernels;   ///< array of begin/end iterator of shifting masks.
   std::vector< DigitalSet * > myKernelsSet; ///< Array of shifting masks. Size = 9 for each shifting (0-adjacent and full kernel included)
@@ -314,8 +389,11 @@ private:
   CountedPtr<ShapePointFunctor>  myShapePointFunctor; ///< Smart pointer on functor point -> {0,1}
   CountedPtr<ShapeSpelFunctor>   myShapeSpelFunctor;  ///< Smart pointer on functor spel ->  {0,1}
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
+  CountedPtr<SweepConvolver>     mySweepConvolver; ///< Convolver of the Sweep engine
+  IIConvolutionEngine            myEngine;      ///< Convolution engine
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (buy may be non integer).
+  std::vector< Scalar > myRadii;            ///< "digital" radii of the kernels (evalMultiscale), the last one is myRadius.
 
 private:
 
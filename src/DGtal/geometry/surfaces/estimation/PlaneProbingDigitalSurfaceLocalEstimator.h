@@ -41,8 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include <unordered_map>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
 #include "DGtal/geometry/surfaces/estimation/MaximalSegmentSliceEstimation.h"
 #include "DGtal/topology/KhalimskyCellHashFunctions.h"
@@ -61,6 +63,10 @@ namespace DGtal
    * This class uses a plane-probing algorithm (whose type is given by the template parameter TProbingAlgorithm) to estimate
    * normal vectors on a digital surface per surfel.
    *
+   * On a range of surfels, the probing algorithms may run in parallel (see setNbThreads):
+   * each surfel is probed by its own instance of the probing algorithm, all of them sharing
+   * the same read-only InPlane predicate.
+   *
    * @tparam TSurface the digital surface type.
    * @tparam TInternalProbingAlgorithm the probing algorithm (see \ref PlaneProbingTetrahedronEstimator or PlaneProbingParallelepipedEstimator).
    *
@@ -220,7 +226,9 @@ namespace DGtal
     Quantity eval (SurfelConstIterator it);
 
     /**
-     * Estimates the quantity on a range of surfels.
+     * Estimates the quantity on a range of surfels. The missing pre-estimations
+     * are computed first, then the surfels are probed, in parallel
+     * if more than one thread is allowed (see setNbThreads).
      *
      * @param itb an iterator on the start of the range of surfels.
      * @param ite a past-the-end iterator of the range of surfels.
@@ -254,6 +262,16 @@ namespace DGtal
                     std::unordered_map<Surfel, RealPoint> const& aPreEstimations = {},
                     bool aVerbose = false);
 
+    /**
+     * Sets the maximal number of threads used by the eval method on a range of surfels.
+     *
+     * @param nbThreads the number of threads, 1 (default) means a sequential evaluation,
+     * 0 means functions::parallelNbThreads().
+     *
+     * @pre the probing factory may be called concurrently if @a nbThreads is not 1.
+     */
+    void setNbThreads (unsigned int nbThreads);
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -281,7 +299,6 @@ namespace DGtal
 
     // ------------------------- Private Datas --------------------------------
   private:
-    InternalProbingAlgorithm* myProbingAlgorithm = nullptr; /**< A pointer on the probing algorithm, instantiated in eval. */
     Scalar myH; /**< The gridstep. */
     CountedConstPtrOrConstPtr<Surface> mySurface; /**< A constant pointer on the digital surface. */
     Predicate myPredicate; /**< The InPlane predicate. */
@@ -289,12 +306,22 @@ namespace DGtal
     ProbingFactory myProbingFactory; /**< A factory function to build plane-probing estimators from a frame, used in eval. */
     mutable std::unordered_map<Surfel, RealPoint> myPreEstimations; /**< A hashmap of pre-estimation vectors */
     bool myVerbose; /**< Verbosity flag. */
+    unsigned int myNbThreads = 1; /**< The maximal number of threads used by eval on a range. */
 
     // ------------------------- Hidden services ------------------------------
   protected:
 
     // ------------------------- Internals ------------------------------------
   private:
+    /**
+     * Estimates the normal vector on a surfel with a new instance of the probing algorithm.
+     *
+     * @param aSurfel a surfel.
+     * @param aPreEstimation the pre-estimation vector on this surfel.
+     * @return the estimated quantity.
+     */
+    Quantity probe (Surfel const& aSurfel, RealPoint const& aPreEstimation) const;
+
     /**
      * Builds a probing frame (a base point and three vectors, see ProbingFrame) over a surfel.
      *
@@ -368,16 +395,17 @@ namespace DGtal
     /**
      * Computes the estimated normal when we detected that one direction of the space was flat.
      *
+     * @param aProbingAlgorithm a probing algorithm.
      * @param aIndex an integer between 0 and 2.
      * @return the estimated normal.
      */
-    Point getNormalOneFlatDirection (int aIndex) const
+    static Point getNormalOneFlatDirection (InternalProbingAlgorithm const& aProbingAlgorithm, int aIndex)
     {
         int im1 = (aIndex - 1 + 3) % 3,
             im2 = (aIndex - 2 + 3) % 3;
 
-        return myProbingAlgorithm->m(im1).crossProduct(myProbingAlgorithm->m(aIndex)) +
-            myProbingAlgorithm->m(aIndex).crossProduct(myProbingAlgorithm->m(im2));
+        return aProbingAlgorithm.m(im1).crossProduct(aProbingAlgorithm.m(aIndex)) +
+            aProbingAlgorithm.m(aIndex).crossProduct(aProbingAlgorithm.m(im2));
     }
   }; // end of class PlaneProbingDigitalSurfaceLocalEstimator
 
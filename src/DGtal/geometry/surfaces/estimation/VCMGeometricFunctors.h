@@ -96,11 +96,11 @@ namespace DGtal {
       */
       Quantity operator()( const Surfel & s ) const
       {
-        typedef typename VCMOnDigitalSurface::Surfel2Normals Surfel2Normals;
         ASSERT( myVCMOnDigitalSurface != 0 );
-        typename Surfel2Normals::const_iterator itSN = myVCMOnDigitalSurface->mapSurfel2Normals().find( s );
-        ASSERT( itSN != myVCMOnDigitalSurface->mapSurfel2Normals().end() );
-        return - itSN->second.vcmNormal;
+        typename VCMOnDigitalSurface::Normals normals;
+        bool ok = myVCMOnDigitalSurface->getNormals( normals, s );
+        ASSERT( ok ); boost::ignore_unused_variable_warning( ok );
+        return - normals.vcmNormal;
       }
 
     private:
@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/kernel/Point2ScalarFunctors.h"
@@ -67,6 +70,11 @@ namespace DGtal
    * diagonalisation of the VCM, and the orientation of the first VCM
    * eigenvector toward the interior of the surface.
    *
+   * The convolved VCM of the points and the normals of the surfels
+   * are stored in arrays, in the order of VCM::points() and of the
+   * sorted surfels (see \ref surfels). They may be computed in
+   * parallel (see the constructor).
+   *
    * @note Documentation in \ref moduleVCM_sec3_1.
    *
    * @see VoronoiCovarianceMeasure
@@ -156,13 +164,20 @@ namespace DGtal
      * @param aMetric an instance of the metric (used for the Voronoi map construction).
      *
      * @param verbose if 'true' displays information on ongoing computation.
+     *
+     * @param nbThreads the maximal number of threads, 1 (default)
+     * for a sequential computation, 0 means
+     * functions::parallelNbThreads(). With several threads, the
+     * metric and the kernel function \a chi_r must be safe to call
+     * concurrently.
      */
     VoronoiCovarianceMeasureOnDigitalSurface( ConstAlias< Surface > _surface, 
                                               Surfel2PointEmbedding _surfelEmbedding,
                                               Scalar _R, Scalar _r, 
                                               KernelFunction chi_r,
                                               Scalar t = 2.5, Metric aMetric = Metric(), 
-                                              bool verbose = false );
+                                              bool verbose = false,
+                                              unsigned int nbThreads = 1 );
 
     /// the const-aliased digital surface.
     CountedConstPtrOrConstPtr< Surface > surface() const;
@@ -188,12 +203,31 @@ namespace DGtal
     template <typename PointOutputIterator>
     PointOutputIterator getPoints( PointOutputIterator outIt, Surfel s ) const; 
 
+    /// @return the surfels of the surface, sorted.
+    const std::vector<Surfel>& surfels() const;
+
+    /// @return the normals (vcm and trivial normal) of each surfel,
+    /// in the same order as \ref surfels.
+    const std::vector<Normals>& normals() const;
+
+    /**
+       Gets the normals (vcm and trivial normal) at surfel \a s, in O(log n) operations.
+       @param[out] n the normals at \a s.
+       @param[in] s the surfel
+       @return 'true' is the surfel \a s was valid.
+    */
+    bool getNormals( Normals& n, Surfel s ) const;
+
     /// @return a const-reference to the map Surfel -> Normals (vcm and trivial normal).
+    /// @note the map is built from \ref normals at the first call,
+    /// which may be done concurrently by several threads.
     const Surfel2Normals& mapSurfel2Normals() const;
 
     /// @return a const-reference to the map Point ->
     /// EigenStructure of the chi_r VCM (eigenvalues and
     /// eigenvectors).
+    /// @note the map is built at the first call, which may be done
+    /// concurrently by several threads.
     const Point2EigenStructure& mapPoint2ChiVCM() const;
 
     /**
@@ -243,10 +277,18 @@ namespace DGtal
     /// used for finding the correct orientation inside/outside for
     /// the VCM.
     Scalar myRadiusTrivial;
-    /// Stores for each point p its convolved VCM, i.e. VCM( chi_r( p ) )
-    Point2EigenStructure myPt2EigenStructure;
-    /// Stores for each surfel its vcm normal and its trivial normal.
-    Surfel2Normals mySurfel2Normals;
+    /// Stores for each point p of myVCM.points() its convolved VCM, i.e. VCM( chi_r( p ) )
+    std::vector<EigenStructure> myEigenStructures;
+    /// The sorted surfels of the surface.
+    std::vector<Surfel> mySurfels;
+    /// Stores for each surfel of mySurfels its vcm normal and its trivial normal.
+    std::vector<Normals> myNormals;
+    /// The map Point -> EigenStructure, built on demand by mapPoint2ChiVCM.
+    mutable Point2EigenStructure myPt2EigenStructure;
+    /// The map Surfel -> Normals, built on demand by mapSurfel2Normals.
+    mutable Surfel2Normals mySurfel2Normals;
+    /// Protects the construction of myPt2EigenStructure and mySurfel2Normals.
+    mutable std::mutex myMapsMutex;
 
     // ------------------------- Private Datas --------------------------------
   private:
@@ -280,6 +322,12 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       @param p any point.
+       @return the convolved VCM of \a p, or 0 if \a p is not a point of the surface.
+    */
+    const EigenStructure* eigenStructure( const Point& p ) const;
+
   }; // end of class VoronoiCovarianceMeasureOnDigitalSurface
 
 
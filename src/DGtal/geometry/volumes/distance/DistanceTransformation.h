@@ -143,10 +143,12 @@ namespace DGtal
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           unsigned int nbThreads = 1):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          nbThreads)
     {}
 
     /**
@@ -157,11 +159,13 @@ namespace DGtal
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
                            ConstAlias<SeparableMetric> aMetric,
-                           typename Parent::PeriodicitySpec const & aPeriodicitySpec)
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec,
+                           unsigned int nbThreads = 1)
       : VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                             predicate,
                                                                             aMetric,
-                                                                            aPeriodicitySpec)
+                                                                            aPeriodicitySpec,
+                                                                            nbThreads)
     {}
 
     /**
@@ -187,8 +187,8 @@ namespace DGtal
      * straight line.
      *
      * This method is in @f$ O(log(n))@f$ if @a n is the size of the
-     * straight segment. For @f$ l_2@f$ metric (p=2), the method is in
-     * @f$ O(1)@f$.
+     * straight segment. For @f$ l_1@f$ (p=1) and @f$ l_2@f$ (p=2)
+     * metrics, the method is in @f$ O(1)@f$.
      *
      * @pre u,v and w must be such that u[dim] < v[dim] < w[dim]
      *
@@ -228,6 +228,10 @@ namespace DGtal
      * distance. It returns the abscissa @a q such that q belongs to
      * the power cell of u (strictly) but not @a q-1.
      *
+     * For p=1, the abscissa is computed in closed form in @f$ O(1)@f$
+     * (selected at compile time), since the difference of the
+     * distances to u and v is piecewise linear and monotonous.
+     *
      * @pre udim < vdim
      *
      * @param udim coordinate of u along dimension dim
@@ -46,8 +46,10 @@
 // Inclusions
 #include <iostream>
 #include <limits>
+#include <algorithm>
 #include <map>
 #include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/images/CImage.h"
@@ -98,6 +100,226 @@ namespace DGtal
     };
   }
 
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMOrderedCandidateQueue
+  /**
+   * Description of template class 'FMMOrderedCandidateQueue' <p>
+   * \brief Aim: Priority queue of candidate points used by FMM, 
+   * implemented as a STL set of pairs (point, tentative value)
+   * ordered by detail::PointValueCompare. 
+   *
+   * This is the default candidate queue of FMM. Each push and pop 
+   * costs a tree insertion or removal. 
+   *
+   * @tparam TPoint a type of point
+   * @tparam TValue a type of distance value
+   *
+   * @see FMMBucketCandidateQueue
+   */
+  template <typename TPoint, typename TValue>
+  class FMMOrderedCandidateQueue
+  {
+  public: 
+    typedef std::pair<TPoint, TValue> PointValue; 
+    typedef std::set<PointValue,
+		     detail::PointValueCompare<PointValue> > Container; 
+    typedef typename Container::size_type Size; 
+
+    /**
+     * @return 'true' if there is no candidate, 'false' otherwise
+     */
+    bool empty() const { return myContainer.empty(); }
+
+    /**
+     * @return the number of candidates (duplicated points included)
+     */
+    Size size() const { return myContainer.size(); }
+
+    /**
+     * Removes all the candidates
+     */
+    void clear() { myContainer.clear(); }
+
+    /**
+     * Inserts a new candidate. 
+     * @param aPair a pair (point, tentative value)
+     */
+    void push( const PointValue& aPair ) { myContainer.insert( aPair ); }
+
+    /**
+     * @pre the queue is not empty
+     * @return the candidate of min (absolute) value 
+     */
+    const PointValue& top() const 
+    { 
+      ASSERT( !empty() ); 
+      return *myContainer.begin(); 
+    }
+
+    /**
+     * Removes the candidate of min (absolute) value
+     * @pre the queue is not empty
+     */
+    void pop() 
+    { 
+      ASSERT( !empty() ); 
+      myContainer.erase( myContainer.begin() ); 
+    }
+
+  private: 
+    /// Ordered set of candidates
+    Container myContainer; 
+  }; 
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMBucketCandidateQueue
+  /**
+   * Description of template class 'FMMBucketCandidateQueue' <p>
+   * \brief Aim: Bucketed (Dial-like) priority queue of candidate 
+   * points used by FMM. 
+   *
+   * The candidates are dispatched into buckets of width @a w 
+   * according to their absolute tentative value: the bucket of index 
+   * @e k contains the values lying in [ k.w, (k+1).w ). Each bucket is 
+   * a small binary heap stored in a contiguous array. Since the front 
+   * propagates by increasing values, the buckets are visited in 
+   * increasing order, so that pushing and popping a candidate only 
+   * costs a heap operation within a bucket whose size is roughly the 
+   * number of candidates of the band of width @a w, instead of a tree 
+   * operation within the whole band. Emptied buckets release their memory.  
+   *
+   * The candidates are returned in exactly the same order as 
+   * FMMOrderedCandidateQueue (the same comparator is used within a 
+   * bucket), so that FMM returns the same distance values with both 
+   * queues. The only difference is that a pair (point, value) may be 
+   * stored twice, which is harmless because FMM skips candidates 
+   * that have already been accepted. 
+   *
+   * The default bucket width is 1, which is well suited to the 
+   * local distances of FMMPointFunctors.h for a unit grid step. 
+   *
+   * @tparam TPoint a type of point
+   * @tparam TValue a type of distance value
+   *
+   * @see FMM
+   */
+  template <typename TPoint, typename TValue>
+  class FMMBucketCandidateQueue
+  {
+  public: 
+    typedef std::pair<TPoint, TValue> PointValue; 
+    typedef std::vector<PointValue> Bucket; 
+    typedef std::size_t Size; 
+
+    /**
+     * Constructor.
+     * @param aWidth width of the buckets (strictly positive), 
+     * 1 by default. 
+     */
+    FMMBucketCandidateQueue( double aWidth = 1.0 )
+      : myWidth( aWidth ), myFirst( 0 ), mySize( 0 )
+    { ASSERT( myWidth > 0 ); }
+
+    /**
+     * @return the width of the buckets
+     */
+    double width() const { return myWidth; }
+
+    /**
+     * @return 'true' if there is no candidate, 'false' otherwise
+     */
+    bool empty() const { return mySize == 0; }
+
+    /**
+     * @return the number of candidates (duplicated points included)
+     */
+    Size size() const { return mySize; }
+
+    /**
+     * Removes all the candidates
+     */
+    void clear() 
+    { 
+      myBuckets.clear(); 
+      myFirst = 0; 
+      mySize = 0; 
+    }
+
+    /**
+     * Inserts a new candidate. 
+     * @param aPair a pair (point, tentative value)
+     */
+    void push( const PointValue& aPair ) 
+    {
+      const Size k = bucketIndex( aPair.second ); 
+      if ( k >= myBuckets.size() ) 
+        myBuckets.resize( k+1 ); 
+      Bucket& b = myBuckets[ k ]; 
+      b.push_back( aPair ); 
+      std::push_heap( b.begin(), b.end(), InverseCompare() ); 
+      if ( (mySize == 0) || (k < myFirst) ) myFirst = k; 
+      ++mySize; 
+    }
+
+    /**
+     * @pre the queue is not empty
+     * @return the candidate of min (absolute) value 
+     */
+    const PointValue& top() const 
+    { 
+      ASSERT( !empty() ); 
+      ASSERT( !myBuckets[ myFirst ].empty() ); 
+      return myBuckets[ myFirst ].front(); 
+    }
+
+    /**
+     * Removes the candidate of min (absolute) value
+     * @pre the queue is not empty
+     */
+    void pop() 
+    {
+      ASSERT( !empty() ); 
+      Bucket& b = myBuckets[ myFirst ]; 
+      std::pop_heap( b.begin(), b.end(), InverseCompare() ); 
+      b.pop_back(); 
+      --mySize; 
+      if ( b.empty() ) 
+        {
+          Bucket().swap( b ); 
+          if ( mySize == 0 ) 
+            myFirst = 0; 
+          else 
+            while ( myBuckets[ myFirst ].empty() ) ++myFirst; 
+        }
+    }
+
+  private: 
+    /// Comparator turning std heaps into min-heaps 
+    struct InverseCompare 
+    {
+      bool operator()( const PointValue& a, const PointValue& b ) const
+      { return detail::PointValueCompare<PointValue>()( b, a ); }
+    }; 
+
+    /**
+     * @param aValue any value
+     * @return index of the bucket of @a aValue
+     */
+    Size bucketIndex( const TValue& aValue ) const 
+    {
+      return static_cast<Size>( std::abs( static_cast<double>( aValue ) ) / myWidth ); 
+    }
+
+    /// Width of the buckets
+    double myWidth; 
+    /// Buckets, indexed by value 
+    std::vector<Bucket> myBuckets; 
+    /// Index of the first non-empty bucket (if any)
+    Size myFirst; 
+    /// Number of candidates 
+    Size mySize; 
+  }; 
+
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -131,6 +353,8 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TCandidateQueue priority queue of pairs (point, value), 
+   * either FMMOrderedCandidateQueue (default) or FMMBucketCandidateQueue
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMSimpleTypeDef3D
@@ -146,7 +370,9 @@ namespace DGtal
    * @see testFMM.cpp
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>,
+	    typename TCandidateQueue = 
+	    FMMOrderedCandidateQueue<typename TImage::Point, typename TPointFunctor::Value> >
   class FMM
   {
 
@@ -182,8 +408,8 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     detail::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef TCandidateQueue CandidatePointSet; 
+    BOOST_STATIC_ASSERT(( boost::is_same< PointValue, typename CandidatePointSet::PointValue >::value ));
     typedef DGtal::uint64_t Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -520,9 +746,9 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor, typename TCandidateQueue >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TCandidateQueue> & object );
 
 } // namespace DGtal
 
@@ -48,6 +48,7 @@
 #include <array>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -97,10 +98,20 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * Along dimensions other than the first one, blocks of adjacent
+   * lines are copied to a transposed buffer with contiguous row
+   * accesses and processed together, which avoids strided accesses
+   * to the image container.
+   *
+   * The computation is sequential by default. It may be done in
+   * parallel by giving a number of threads to the constructor: on
+   * @a p processors, expected runtime is then in @f$ O(h.d.n^d /
+   * p)@f$. OpenMP is used if DGtal has been built with OpenMP support
+   * (WITH_OPENMP flag set to "true"), std::thread otherwise (see
+   * functions::parallelFor). In this case, the image container must
+   * support concurrent calls to setValue on distinct points, and the
+   * methods of the metric (closest, hiddenBy) must be safe to call
+   * concurrently.
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -204,10 +215,15 @@ namespace DGtal
      * Voronoi sites (false points).
      *
      * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param nbThreads the number of threads used by the computation,
+     * 1 (default) for a sequential computation, 0 for all the threads
+     * (see functions::parallelFor).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               unsigned int nbThreads = 1);
 
     /**
      * Constructor with periodicity specification.
@@ -232,11 +248,16 @@ namespace DGtal
      * @param aPeriodicitySpec an array of size equal to the space dimension
      *        where the i-th value is \c true if the i-th dimension of the
      *        space is periodic, \c false otherwise.
+     *
+     * @param nbThreads the number of threads used by the computation,
+     * 1 (default) for a sequential computation, 0 for all the threads
+     * (see functions::parallelFor).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
-               PeriodicitySpec const & aPeriodicitySpec);
+               PeriodicitySpec const & aPeriodicitySpec,
+               unsigned int nbThreads = 1);
     /**
      * Default destructor
      */
@@ -295,6 +316,15 @@ namespace DGtal
       return myMetricPtr;
     }
 
+    /**
+     * @return the number of threads used by the computation (0 means
+     * all the threads).
+     */
+    unsigned int nbThreads() const
+    {
+      return myNbThreads;
+    }
+
     /** Periodicity specification.
      *
      * @returns the periodicity specification array.
@@ -357,11 +387,17 @@ namespace DGtal
      * the 1D span starting at @a row along the dimension @a
      * dim.
      *
+     * The span is read from and written to a local copy @a aLine,
+     * whose i-th element is the map value at the i-th point of the
+     * span (from the lower bound of the domain along @a dim).
+     *
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] aLine local copy of the span.
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             Point * aLine) const;
 
     /**
      * Project a coordinate into the domain, taking into account
@@ -400,6 +436,10 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Number of lines processed at once by a thread (when the
+    /// lines are not along the dimension 0).
+    static const std::size_t myBlockSize = 16;
+
   protected:
 
     ///Pointer to the separable metric instance
@@ -411,6 +451,9 @@ namespace DGtal
     /// Periodicity along each dimension.
     PeriodicitySpec myPeriodicitySpec;
 
+    /// Number of threads of the computation (0 means all the threads).
+    unsigned int myNbThreads;
+
   }; // end of class VoronoiMap
 
   /**
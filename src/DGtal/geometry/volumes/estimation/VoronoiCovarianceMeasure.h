@@ -42,6 +42,9 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -64,8 +67,16 @@ namespace DGtal
    * of a set of points. It can compute the covariance measure of an
    * arbitrary function with given support.
    *
-   * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * The points of K are sorted and numbered, and the VCM of their
+   * Voronoi cells are stored in an array indexed by these numbers
+   * (see \ref points, \ref vcms and \ref index). The VCM of the
+   * Voronoi cells may be accumulated in parallel (see the
+   * constructor), by slabs of the domain thick enough so that slabs
+   * processed at the same time never update the same cell. The
+   * kernel functions are integrated by
+   * looking for the points of K in a grid of buckets of size r.
+   * You may also obtain the whole sequence (Point,VCM) as the map
+   * \ref vcmMap.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -89,7 +100,10 @@ namespace DGtal
     typedef typename Space::Integer Integer;      ///< the type of each digital point coordinate, some integral type
     typedef DGtal::HyperRectDomain<Space> Domain; ///< the type of rectangular domain of the VCM.
     typedef DGtal::ImageContainerBySTLVector<Domain,bool> CharacteristicSet; ///< the type of a binary image that is the characteristic function of K.
-    typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure; ///< the structure used for proximity queries.
+    typedef DGtal::uint32_t Index;                ///< the type for numbering the points of K.
+    /// The structure formerly used for proximity queries.
+    /// @deprecated no longer used: proximity queries use a grid of buckets (see \ref measure).
+    typedef DGtal::SpatialCubicalSubdivision<Space> ProximityStructure;
 
     /**
        A predicate that returns 'true' whenever the given binary image contains 'true'.
@@ -121,6 +135,7 @@ namespace DGtal
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
+    typedef std::vector<MatrixNN> MatrixNNContainer;          ///< the list of matrices
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -139,8 +154,13 @@ namespace DGtal
      *
      * @param aMetric an instance of the metric.
      * @param verbose if 'true' displays information on ongoing computation.
+     * @param nbThreads the maximal number of threads of \ref init,
+     * 1 (default) for a sequential computation, 0 means
+     * functions::parallelNbThreads(). With several threads, the
+     * metric must be safe to call concurrently (see VoronoiMap).
      */
-    VoronoiCovarianceMeasure( double _R, double _r, Metric aMetric = Metric(), bool verbose = false );
+    VoronoiCovarianceMeasure( double _R, double _r, Metric aMetric = Metric(), bool verbose = false,
+                              unsigned int nbThreads = 1 );
 
     /**
      * Destructor.
@@ -155,8 +175,9 @@ namespace DGtal
     Scalar r() const;
  
     /**
-       Cleans intermediate data structure likes the characteristic set and the voronoi map.
-       @note Further calls to voronoiMap are no more valid.
+       Cleans intermediate data structure likes the characteristic
+       set, the voronoi map and the grid of points.
+       @note Further calls to voronoiMap and measure are no more valid.
     */
     void clean();
 
@@ -179,9 +200,28 @@ namespace DGtal
     /// @pre init must have been called before.
     const Voronoi& voronoiMap() const;
 
+    /// @return the points of K, sorted and without duplicates. The
+    /// index of a point is its position in this container.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& points() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell, in
+    /// the same order as \ref points.
+    /// @note empty if \ref init has not been called.
+    const MatrixNNContainer& vcms() const;
+
+    /**
+       @param p any point.
+       @return the index of \a p in \ref points, or points().size()
+       if \a p is not a point of K (in O(log n) operations).
+    */
+    Index index( const Point& p ) const;
+
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note the map is built from \ref vcms at the first call,
+    /// which may be done concurrently by several threads.
     const Point2MatrixNN& vcmMap() const;
 
     /**
@@ -196,6 +236,8 @@ namespace DGtal
     VoronoiCovarianceMeasure).
     
     @param p the point where the kernel function is moved. It must lie within domain.
+
+    @note This method may be called concurrently by several threads.
     */
     template <typename Point2ScalarFunction>
     MatrixNN measure( Point2ScalarFunction chi_r, Point p ) const;
@@ -229,16 +271,31 @@ namespace DGtal
     Metric myMetric;
     /// Tells if it is verbose mode.
     bool myVerbose;
+    /// The maximal number of threads (0 means functions::parallelNbThreads()).
+    unsigned int myNbThreads;
     /// The domain in which all computations are done.
     Domain myDomain;
     /// A binary image that defines the characteristic set of K.
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
-    /// The structure used for proximity queries.
-    ProximityStructure* myProximityStructure;
+    /// The sorted points of K.
+    PointContainer myPoints;
+    /// The VCM of the Voronoi cell of each point of K.
+    MatrixNNContainer myVCMs;
+    /// The map point -> VCM, built on demand by vcmMap.
+    mutable Point2MatrixNN myVCM;
+    /// Protects the construction of myVCM.
+    mutable std::mutex myVCMMutex;
+    /// The size of the buckets of the grid used for proximity queries.
+    Integer myBinSize;
+    /// The number of buckets along each axis.
+    Point myBinExtent;
+    /// For each bucket, the position of its first point in myBinPoints
+    /// (plus the total number of points at the end).
+    std::vector<Index> myBinStarts;
+    /// The indices of the points of K, sorted by bucket.
+    std::vector<Index> myBinPoints;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -269,6 +326,23 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Accumulates in myVCMs the covariance matrix of each point
+       of the domain within the R-offset of K (see \ref init).
+    */
+    void computeVCMs();
+
+    /**
+       Builds the grid of buckets used for proximity queries.
+    */
+    void computeBins();
+
+    /**
+       @param p any point.
+       @return the coordinates of the bucket containing \a p.
+    */
+    Point bin( const Point& p ) const;
+
   }; // end of class VoronoiCovarianceMeasure
 
 
@@ -1161,23 +1161,27 @@ namespace DGtal
           }	
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-        // Extracts all boundary surfels
-        SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
+        // Extracts all boundary surfels (sorted)
+        SurfelRange all_surfels;
+        Surfaces<KSpace>::sMakeSortedBoundary( all_surfels, K, *bimage,
+                                               K.lowerBound(), K.upperBound() );
         // Builds all connected components of surfels.
-        SurfelSet marked_surfels;
+        std::vector<bool> marked_surfels( all_surfels.size(), false );
         CountedPtr<LightDigitalSurface> ptrSurface;
-        for ( auto bel : all_surfels )
+        for ( std::size_t i = 0; i < all_surfels.size(); ++i )
           {
-            if ( marked_surfels.count( bel ) != 0 ) continue;
+            if ( marked_surfels[ i ] ) continue;
+            const Surfel bel = all_surfels[ i ];
             surfel_reps.push_back( bel );
             LightSurfaceContainer* surfContainer
               = new LightSurfaceContainer( K, *bimage, surfAdj, bel );
             ptrSurface = CountedPtr<LightDigitalSurface>
               ( new LightDigitalSurface( surfContainer ) ); // acquired
             // mark all surfels of the surface component.
-            marked_surfels.insert( ptrSurface->begin(), ptrSurface->end() );
+            for ( auto && s : *ptrSurface )
+              marked_surfels[ std::lower_bound( all_surfels.cbegin(),
+                                                all_surfels.cend(), s )
+                              - all_surfels.cbegin() ] = true;
             // add surface component to result.
             result.push_back( ptrSurface );
           }
@@ -1210,14 +1214,16 @@ namespace DGtal
           const KSpace&           K,
           const Parameters&       params = parametersDigitalSurface() )
         {
-          SurfelSet all_surfels;
+          SurfelRange sorted_surfels;
           bool      surfel_adjacency = params[ "surfelAdjacency" ].as<int>();
           SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-          // Extracts all boundary surfels
-          Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                           K.lowerBound(), K.upperBound() );
+          // Extracts all boundary surfels (sorted, hence the set is
+          // built in linear time)
+          Surfaces<KSpace>::sMakeSortedBoundary( sorted_surfels, K, *bimage,
+                                                 K.lowerBound(), K.upperBound() );
           ExplicitSurfaceContainer* surfContainer
-            = new ExplicitSurfaceContainer( K, surfAdj, all_surfels );
+            = new ExplicitSurfaceContainer
+            ( K, surfAdj, SurfelSet( sorted_surfels.cbegin(), sorted_surfels.cend() ) );
           return CountedPtr< DigitalSurface >
 	    ( new DigitalSurface( surfContainer ) ); // acquired
         }
@@ -1285,8 +1291,10 @@ namespace DGtal
           }
         else if ( component == "All" )
           {
-            Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
-                                             K.lowerBound(), K.upperBound() );
+            SurfelRange sorted_surfels;
+            Surfaces<KSpace>::sMakeSortedBoundary( sorted_surfels, K, *bimage,
+                                                   K.lowerBound(), K.upperBound() );
+            surfels.insert( sorted_surfels.cbegin(), sorted_surfels.cend() );
           }
         return makeIdxDigitalSurface( surfels, K, params );
       }    
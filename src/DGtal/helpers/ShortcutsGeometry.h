@@ -638,6 +638,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
       static Parameters parametersGeometryEstimation()
       {
@@ -648,6 +649,7 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
+          ( "iiEngine",    "masks" )
           ( "surfelEmbedding",   0 );
       }
 
@@ -742,6 +744,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
       ///
@@ -820,6 +823,28 @@ namespace DGtal
           return n_estimations;
         }
 
+      /// Reads the II convolution engine in the parameters \a params.
+      ///
+      /// @param[in] params the parameters:
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" or "sweep".
+      /// @param[out] engine the corresponding convolution engine.
+      /// @return 'false' if the convolution engine is unknown.
+      static bool
+        getIIConvolutionEngine( const Parameters& params,
+                                IIConvolutionEngine& engine )
+        {
+          const std::string name = params[ "iiEngine" ].as<std::string>();
+          if ( name == "masks" )      engine = IIConvolutionEngine::Masks;
+          else if ( name == "sweep" ) engine = IIConvolutionEngine::Sweep;
+          else
+            {
+              trace.error() << "[ShortcutsGeometry::getIIConvolutionEngine] Unknown II convolution engine: "
+                            << name << " (should be masks or sweep)" << std::endl;
+              return false;
+            }
+          return true;
+        }
+
       /// Given a digital shape \a bimage, a sequence of \a surfels,
       /// and some parameters \a params, returns the normal Integral
       /// Invariant (II) estimation at the specified surfels, in the
@@ -831,6 +856,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -866,6 +892,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -907,6 +934,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated normals, in the
@@ -948,6 +976,9 @@ namespace DGtal
           IINormalEstimator   ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          IIConvolutionEngine engine;
+          if ( ! getIIConvolutionEngine( params, engine ) ) return n_estimations;
+          ii_estimator.setEngine( engine );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( n_estimations ) );
@@ -968,6 +999,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
@@ -999,6 +1031,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -1038,6 +1071,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
@@ -1075,6 +1109,9 @@ namespace DGtal
           IIMeanCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          IIConvolutionEngine engine;
+          if ( ! getIIConvolutionEngine( params, engine ) ) return mc_estimations;
+          ii_estimator.setEngine( engine );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1092,6 +1129,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -1123,6 +1161,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -1162,6 +1201,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -1199,6 +1239,9 @@ namespace DGtal
           IIGaussianCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          IIConvolutionEngine engine;
+          if ( ! getIIConvolutionEngine( params, engine ) ) return mc_estimations;
+          ii_estimator.setEngine( engine );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1217,6 +1260,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
@@ -1249,6 +1293,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
@@ -1288,6 +1333,7 @@ namespace DGtal
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
+      ///   - iiEngine        ["masks"]: the II convolution engine, either "masks" (shifting masks, best for depth-first ranges of surfels and small radii) or "sweep" (summed row tables, best for large radii).
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
@@ -1324,6 +1370,9 @@ namespace DGtal
         IICurvEstimator ii_estimator( functor );
         ii_estimator.attach( K, shape );
         ii_estimator.setParams( r );
+        IIConvolutionEngine engine;
+        if ( ! getIIConvolutionEngine( params, engine ) ) return mc_estimations;
+        ii_estimator.setEngine( engine );
         ii_estimator.init( h, surfels.begin(), surfels.end() );
         ii_estimator.eval( surfels.begin(), surfels.end(),
                           std::back_inserter( mc_estimations ) );
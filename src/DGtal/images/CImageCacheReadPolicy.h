@@ -46,6 +46,37 @@
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /**
+     * Gets the page to detach before loading the image of domain aDomain
+     * with the 'getPageToDetach(aDomain)' method of the read policy. The
+     * returned page leaves the cache, so the method can be called again
+     * until it returns NULL: aCallAgain is set to 'true'.
+     *
+     * @param aReadPolicy the read policy.
+     * @param aDomain the domain of the image to load.
+     * @param aCallAgain (returns) 'true' if the policy may have other pages to detach.
+     * @return the page to detach or NULL.
+     */
+    template <typename TReadPolicy, typename TDomain>
+    auto imageCachePageToDetach(TReadPolicy & aReadPolicy, const TDomain & aDomain, bool & aCallAgain, int)
+      -> decltype(aReadPolicy.getPageToDetach(aDomain))
+    {
+      aCallAgain = true;
+      return aReadPolicy.getPageToDetach(aDomain);
+    }
+
+    /// Overload for read policies with a nullary 'getPageToDetach', called once per loaded image.
+    template <typename TReadPolicy, typename TDomain>
+    auto imageCachePageToDetach(TReadPolicy & aReadPolicy, const TDomain &, bool & aCallAgain, long)
+      -> decltype(aReadPolicy.getPageToDetach())
+    {
+      aCallAgain = false;
+      return aReadPolicy.getPageToDetach();
+    }
+  } // namespace detail
+
   namespace concepts
   {
 /////////////////////////////////////////////////////////////////////////////
@@ -83,10 +114,15 @@ Description of \b concept '\b CImageCacheReadPolicy' <p>
 # Invariants
 
 # Models
-ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO
+ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO, ImageCacheReadPolicyLRU
 
 # Notes
 
+Instead of x.getPageToDetach(), a model may provide x.getPageToDetach(d),
+with d the domain of the image to load, which returns the alias on an image
+that we have to detach before loading d. That image leaves the cache: the
+method is called until it returns NULL (see ImageCacheReadPolicyLRU).
+
 @tparam T the type that should be a model of CImageCacheReadPolicy.
  */
 template <typename T>
@@ -101,7 +137,7 @@ public:
     {
         ConceptUtils::sameType( myIC, myT.getPage(myDomain) );
         ConceptUtils::sameType( myIC, myT.getPage(myPoint) );
-        ConceptUtils::sameType( myIC, myT.getPageToDetach() );
+        ConceptUtils::sameType( myIC, detail::imageCachePageToDetach(myT, myDomain, myCallAgain, 0) );
         myT.updateCache(myDomain); 
         myT.clearCache();
 
@@ -119,6 +155,7 @@ private:
     ImageContainer * myIC;
     typename T::Point myPoint;
     typename T::Domain myDomain;
+    bool myCallAgain;
 
     // ------------------------- Internals ------------------------------------
 private:
@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -56,6 +59,32 @@ namespace DGtal
 // CACHE_READ_POLICY_LAST, CACHE_READ_POLICY_FIFO, CACHE_READ_POLICY_LRU, CACHE_READ_POLICY_NEIGHBORS   // read policies
 // CACHE_WRITE_POLICY_WT, CACHE_WRITE_POLICY_WB                                                         // write policies
     
+namespace detail
+{
+  /**
+   * Looks for the page of domain aDomain with the 'findPage' method of
+   * the read policy, which does not change its replacement order.
+   *
+   * @param aReadPolicy the read policy.
+   * @param aDomain the domain.
+   * @return the page or NULL.
+   */
+  template <typename TReadPolicy, typename TDomain>
+  auto imageCacheFindPage(TReadPolicy & aReadPolicy, const TDomain & aDomain, int)
+    -> decltype(aReadPolicy.findPage(aDomain))
+  {
+    return aReadPolicy.findPage(aDomain);
+  }
+
+  /// Overload for read policies without 'findPage': uses 'getPage'.
+  template <typename TReadPolicy, typename TDomain>
+  auto imageCacheFindPage(TReadPolicy & aReadPolicy, const TDomain & aDomain, long)
+    -> decltype(aReadPolicy.getPage(aDomain))
+  {
+    return aReadPolicy.getPage(aDomain);
+  }
+} // namespace detail
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCache
 /**
@@ -72,6 +101,16 @@ namespace DGtal
  *  - read :    for getting the value of an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - write :   for setting a   value on an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - update :  for updating the cache according to the read cache policy
+ * 
+ * In concurrent access mode (see setConcurrentAccess), the cache is shared
+ * between threads: each sequence of calls must then be done while holding
+ * a Lock on the cache. A page can also be pinned (see pinPage): a pinned page
+ * selected for replacement by the read policy leaves the cache but stays in
+ * memory until it is unpinned, so that a thread can keep working on it
+ * without holding the lock. Until then, read, write and getPage still use
+ * that page for its domain instead of loading a second copy, so that the
+ * values written in it are not lost. It is flushed and detached when it is
+ * unpinned for the last time.
  */
 template <typename TImageContainer, typename TImageFactory, typename TReadPolicy, typename TWritePolicy>
 class ImageCache
@@ -116,6 +155,11 @@ public:
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
+      bytesLoaded = 0;
+      
+      myConcurrent = false;
     }
     
     /**
@@ -179,6 +223,18 @@ public:
      */
     ImageContainer * getPage(const Domain & aDomain) const;
 
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain,
+     * without changing the replacement order of the read policy when
+     * it provides a 'findPage' method (see ImageCacheReadPolicyLRU).
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * findPage(const Domain & aDomain) const;
+
     /**
      * Set a value on an image from cache at a given position given
      * by aPoint only if aPoint belongs to an image from cache.
@@ -200,7 +256,7 @@ public:
     /**
      * Get the cacheMissRead value.
      */
-    unsigned int getCacheMissRead()
+    DGtal::uint64_t getCacheMissRead()
     {
         return cacheMissRead;
     }
@@ -208,7 +264,7 @@ public:
     /**
      * Get the cacheMissWrite value.
      */
-    unsigned int getCacheMissWrite()
+    DGtal::uint64_t getCacheMissWrite()
     {
         return cacheMissWrite;
     }
@@ -230,14 +286,134 @@ public:
     }
     
     /**
-     * Clear the cache and reset the cache misses
+     * Get the cacheHitRead value.
+     */
+    DGtal::uint64_t getCacheHitRead()
+    {
+        return cacheHitRead;
+    }
+    
+    /**
+     * Get the cacheHitWrite value.
+     */
+    DGtal::uint64_t getCacheHitWrite()
+    {
+        return cacheHitWrite;
+    }
+    
+    /**
+     * Inc the cacheHitRead value.
+     */
+    void incCacheHitRead()
+    {
+        cacheHitRead++;
+    }
+    
+    /**
+     * Inc the cacheHitWrite value.
+     */
+    void incCacheHitWrite()
+    {
+        cacheHitWrite++;
+    }
+    
+    /**
+     * Get the number of bytes loaded into the cache by 'update'
+     * (number of points of the loaded domains times the size of a Value).
+     */
+    DGtal::uint64_t getBytesLoaded()
+    {
+        return bytesLoaded;
+    }
+    
+    /**
+     * Enables or disables the concurrent access mode. It must not be
+     * changed while the cache is used.
+     * 
+     * @param aConcurrent 'true' to share the cache between threads.
+     */
+    void setConcurrentAccess(bool aConcurrent)
+    {
+        myConcurrent = aConcurrent;
+    }
+    
+    /**
+     * @return 'true' if the concurrent access mode is enabled.
+     */
+    bool isConcurrentAccess() const
+    {
+        return myConcurrent;
+    }
+    
+    /**
+     * Scoped lock on the cache, only taken in concurrent access mode.
+     */
+    class Lock
+    {
+    public:
+      /**
+       * Constructor. Locks aCache if it is in concurrent access mode.
+       * @param aCache the cache.
+       */
+      Lock(const ImageCache & aCache):
+        myLock(aCache.myMutex, std::defer_lock)
+      {
+        if (aCache.myConcurrent)
+          myLock.lock();
+      }
+      
+    private:
+      /// underlying lock
+      std::unique_lock<std::mutex> myLock;
+    };
+    
+    /**
+     * Pin a page: it stays in memory until unpinned, even if the read policy
+     * selects it for replacement.
+     * 
+     * @param aPage a page of the cache.
+     */
+    void pinPage(ImageContainer * aPage);
+    
+    /**
+     * Unpin a page. If the page left the cache while pinned, it is flushed
+     * and detached when it is unpinned for the last time.
+     * 
+     * @param aPage a pinned page.
+     */
+    void unpinPage(ImageContainer * aPage);
+    
+    /**
+     * @return the number of pinned pages.
+     */
+    unsigned int getNbPinnedPages() const
+    {
+        return static_cast<unsigned int>(myPinCounts.size());
+    }
+    
+    /**
+     * Clear the cache and reset the cache misses, the cache hits and
+     * the number of bytes loaded. The pages are unpinned: the pinned
+     * pages that already left the cache are flushed and detached.
      */
     void clearCacheAndResetCacheMisses()
     {
       myReadPolicy->clearCache();
-      
+
+      for (unsigned int i=0; i<myDetachedPinnedPages.size(); i++)
+      {
+        myWritePolicy->flushPage(myDetachedPinnedPages[i]);
+
+        myImageFactoryPtr->detachImage(myDetachedPinnedPages[i]);
+      }
+      myDetachedPinnedPages.clear();
+      myPinCounts.clear();
+
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
+      bytesLoaded = 0;
     }
 
     // ------------------------- Protected Datas ------------------------------
@@ -260,12 +436,43 @@ protected:
 private:
     
     /// cache miss values
-    unsigned int cacheMissRead;
-    unsigned int cacheMissWrite;
+    DGtal::uint64_t cacheMissRead;
+    DGtal::uint64_t cacheMissWrite;
+
+    /// cache hit values
+    DGtal::uint64_t cacheHitRead;
+    DGtal::uint64_t cacheHitWrite;
+    
+    /// number of bytes loaded into the cache
+    DGtal::uint64_t bytesLoaded;
+    
+    /// concurrent access mode
+    bool myConcurrent;
+    
+    /// mutex of the concurrent access mode
+    mutable std::mutex myMutex;
+    
+    /// pin count of the pinned pages
+    std::map<ImageContainer *, unsigned int> myPinCounts;
+    
+    /// pinned pages that left the cache
+    std::vector<ImageContainer *> myDetachedPinnedPages;
 
     // ------------------------- Internals ------------------------------------
 private:
 
+    /**
+     * @param aPoint a point.
+     * @return the pinned page that left the cache and contains aPoint, or NULL.
+     */
+    ImageContainer * findDetachedPinnedPage(const Point & aPoint) const;
+
+    /**
+     * @param aDomain a domain.
+     * @return the pinned page that left the cache and matchs aDomain, or NULL.
+     */
+    ImageContainer * findDetachedPinnedPage(const Domain & aDomain) const;
+
 }; // end of class ImageCache
 
 
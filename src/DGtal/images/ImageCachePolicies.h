@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <deque>
+#include <list>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -129,12 +131,16 @@ public:
     ImageContainer * getPage(const Domain & aDomain);
     
     /**
-     * Get the alias on the image that we have to detach
-     * or NULL if no image have to be detached.
+     * Get the alias on the image that we have to detach before loading
+     * the image of domain aDomain, or NULL if no image have to be detached.
+     * The returned image leaves the cache, so the method is called again
+     * until it returns NULL.
+     *
+     * @param aDomain the domain of the image to load.
      *
      * @return the alias on the image container or NULL pointer.
      */
-    ImageContainer * getPageToDetach();
+    ImageContainer * getPageToDetach(const Domain & aDomain);
     
     /**
      * Update the cache according to the cache policy.
@@ -234,12 +240,16 @@ public:
     ImageContainer * getPage(const Domain & aDomain);
     
     /**
-     * Get the alias on the image that we have to detach
-     * or NULL if no image have to be detached.
+     * Get the alias on the image that we have to detach before loading
+     * the image of domain aDomain, or NULL if no image have to be detached.
+     * The returned image leaves the cache, so the method is called again
+     * until it returns NULL.
+     *
+     * @param aDomain the domain of the image to load.
      *
      * @return the alias on the image container or NULL pointer.
      */
-    ImageContainer * getPageToDetach();
+    ImageContainer * getPageToDetach(const Domain & aDomain);
     
     /**
      * Update the cache according to the cache policy.
@@ -266,6 +276,179 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU (Least Recently Used)' read policy cache 
+ * with a memory budget.
+ * 
+ * The cache keeps track of all the pages in memory in a list ordered by last access, 
+ * with the most recently used page in front. Each successful getPage moves the page 
+ * to the front of the list. 
+ * While the pages in memory plus the page to load would exceed the byte budget, the 
+ * page at the back of the list (the least recently used page) is selected to be replaced.
+ * 
+ * The size of a page is the number of points of its domain times the size of a Value.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aByteBudget maximal number of bytes of the pages kept in memory.
+     */
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory, DGtal::uint64_t aByteBudget):
+       myByteBudget(aByteBudget), myBytes(0), myImageFactory(&anImageFactory)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+    
+private:
+    
+    ImageCacheReadPolicyLRU( const ImageCacheReadPolicyLRU & other );
+    
+    ImageCacheReadPolicyLRU & operator=( const ImageCacheReadPolicyLRU & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * The page becomes the most recently used one.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * The page becomes the most recently used one.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * Unlike getPage, the order of the pages is not changed.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * findPage(const Domain & aDomain) const;
+    
+    /**
+     * Get the alias on the image that we have to detach before loading
+     * the image of domain aDomain, or NULL if no image have to be detached.
+     * The returned image leaves the cache, so the method is called again
+     * until it returns NULL.
+     *
+     * @param aDomain the domain of the image to load.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach(const Domain & aDomain);
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+
+    /**
+     * @return the number of bytes of the pages in memory.
+     */
+    DGtal::uint64_t bytesInCache() const
+    {
+      return myBytes;
+    }
+
+    /**
+     * @return the byte budget of the cache.
+     */
+    DGtal::uint64_t byteBudget() const
+    {
+      return myByteBudget;
+    }
+    
+protected:
+
+    /**
+     * @param anImage an image.
+     * @return the number of bytes of the image.
+     */
+    static DGtal::uint64_t pageBytes(const ImageContainer * anImage)
+    {
+      return domainBytes(anImage->domain());
+    }
+
+    /**
+     * @param aDomain a domain.
+     * @return the number of bytes of an image of domain aDomain.
+     */
+    static DGtal::uint64_t domainBytes(const Domain & aDomain)
+    {
+      return static_cast<DGtal::uint64_t>(aDomain.size()) * sizeof(Value);
+    }
+    
+    /// Alias on the images cache, the most recently used in front
+    std::list <ImageContainer *> myLRUCacheImages;
+    
+    /// Maximal number of bytes of the pages in memory
+    DGtal::uint64_t myByteBudget;
+
+    /// Number of bytes of the pages in memory
+    DGtal::uint64_t myBytes;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyLRU
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
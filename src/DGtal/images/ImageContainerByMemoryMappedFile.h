@@ -0,0 +1,244 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMemoryMappedFile.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageContainerByMemoryMappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMemoryMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMemoryMappedFile.h
+#else // defined(ImageContainerByMemoryMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMemoryMappedFile_RECURSES
+
+#if !defined ImageContainerByMemoryMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMemoryMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <memory>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/io/MemoryMappedFile.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMemoryMappedFile
+  /**
+   * Description of template class 'ImageContainerByMemoryMappedFile' <p>
+   * \brief Aim: read-only image whose values are read on demand from a
+   * memory mapped file (model of CConstImage).
+   *
+   * The file contains, from a given byte offset, the values of the image
+   * as raw words of type TWord stored in the lexicographic order of the
+   * domain points (first dimension first), as written by RawWriter,
+   * VolWriter or LongvolWriter. The file is mapped in constant time and
+   * the words are read, converted from the file endianness and transformed
+   * by the functor only when they are accessed.
+   *
+   * Copies of the image share the same mapping, which is released with the
+   * last copy.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerByMemoryMappedFile<Z3i::Domain, unsigned int, DGtal::uint16_t> Image;
+   * Image image( "data.raw", Z3i::Domain( Z3i::Point(0,0,0), Z3i::Point(511,511,511) ) );
+   * unsigned int v = image( Z3i::Point(1,2,3) );
+   * @endcode
+   *
+   * @see RawReader::mapRaw, VolReader::mapVol, LongvolReader::mapLongvol
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the type of the image values.
+   * @tparam TWord the type of the words stored in the file (TValue by default).
+   * @tparam TFunctor the type of functor converting a word to a value
+   * (by default set to functors::Cast< TValue >).
+   */
+  template <typename TDomain, typename TValue, typename TWord = TValue,
+            typename TFunctor = functors::Cast< TValue > >
+  class ImageContainerByMemoryMappedFile
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef ImageContainerByMemoryMappedFile<TDomain, TValue, TWord, TFunctor> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    typedef TValue Value;
+    typedef TWord Word;
+    typedef TFunctor Functor;
+    BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<TFunctor, TWord, TValue > ));
+
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param filename the name of the file to map.
+     * @param aDomain the image domain.
+     * @param anOffset the position of the first word in the file, in bytes.
+     * @param aFunctor the functor converting a word to a value.
+     * @param isLittleEndian 'true' if the words are stored in little-endian order.
+     *
+     * @throw IOException if the file cannot be mapped or is too small.
+     */
+    ImageContainerByMemoryMappedFile( const std::string & filename,
+                                      const Domain & aDomain,
+                                      std::size_t anOffset = 0,
+                                      const Functor & aFunctor = Functor(),
+                                      bool isLittleEndian = true );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByMemoryMappedFile() {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the image domain.
+     */
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /**
+     * @return the range providing constant iterators on the image values.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * @return the underlying mapped file.
+     */
+    const MemoryMappedFile & file() const
+    {
+      return *myFile;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myFile && myFile->isValid();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    /// Mapped file, shared by the copies of the image
+    std::shared_ptr<const MemoryMappedFile> myFile;
+
+    /// First word of the image
+    const char * myWords;
+
+    /// Functor converting a word to a value
+    Functor myFunctor;
+
+    /// 'true' if the bytes of the words must be swapped
+    bool mySwapBytes;
+
+  }; // end of class ImageContainerByMemoryMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMemoryMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMemoryMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, typename TWord, typename TFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMemoryMappedFile<TDomain, TValue, TWord, TFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMemoryMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMemoryMappedFile_h
+
+#undef ImageContainerByMemoryMappedFile_RECURSES
+#endif // else defined(ImageContainerByMemoryMappedFile_RECURSES)
@@ -46,6 +46,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
@@ -112,7 +113,9 @@ namespace DGtal
    * which is returned by the outputIterator() method for writing purposes.
    *
    * Lastly, built-in iterators and a fast span iterator to perform 1D scans
-   * are also provided.
+   * are also provided, as well as forEachRow() that gives the rows
+   * (lines along the first axis, contiguous in the container) of the
+   * image, possibly in parallel.
    *
    * @tparam TDomain a HyperRectDomain.
    * @tparam TValue at least a model of CLabel.
@@ -519,6 +522,50 @@ namespace DGtal
       return ( *it );
     };
 
+    // ------------- Row traversal --------------------
+
+    /**
+     * Calls @a f( row, length, origin ) for each row of the image (line
+     * of points along the first axis, see HyperRectDomain::forEachRow),
+     * @a row being an iterator on the first value of the row in the
+     * container, @a length the number of values of the row and @a
+     * origin its first point. The values of a row are contiguous, so
+     * that @a f may process them with a tight loop.
+     *
+     * @code
+     * image.forEachRow( [&] ( Iterator row, Size length, const Point & )
+     *   {
+     *     for ( Size i = 0; i < length; ++i ) row[ i ] = row[ i ] > t ? 255 : 0;
+     *   }, 0 );
+     * @endcode
+     *
+     * @param f any functor taking an Iterator, a Size and a Point.
+     * @param nbThreads 1 (default) visits the rows sequentially,
+     * otherwise the rows are visited in parallel by at most @a
+     * nbThreads threads (0 means functions::parallelNbThreads()).
+     * The rows of bool images are always visited sequentially, since
+     * the values of adjacent rows of a vector<bool> share words.
+     *
+     * @tparam TFunction the type of @a f.
+     */
+    template <typename TFunction>
+    void forEachRow ( TFunction f, unsigned int nbThreads = 1 );
+
+    /**
+     * Calls @a f( row, length, origin ) for each row of the image, @a
+     * row being a ConstIterator on the first value of the row (see
+     * forEachRow above).
+     *
+     * @param f any functor taking a ConstIterator, a Size and a Point.
+     * @param nbThreads 1 (default) visits the rows sequentially,
+     * otherwise the rows are visited in parallel by at most @a
+     * nbThreads threads (0 means functions::parallelNbThreads()).
+     *
+     * @tparam TFunction the type of @a f.
+     */
+    template <typename TFunction>
+    void forEachRow ( TFunction f, unsigned int nbThreads = 1 ) const;
+
 
 
 
@@ -0,0 +1,294 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryWithPrefetch.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ImageFactoryWithPrefetch.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryWithPrefetch_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryWithPrefetch.h
+#else // defined(ImageFactoryWithPrefetch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryWithPrefetch_RECURSES
+
+#if !defined ImageFactoryWithPrefetch_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryWithPrefetch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <future>
+#include <chrono>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImageFactory.h"
+#include "DGtal/base/Alias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryWithPrefetch
+  /**
+   * Description of template class 'ImageFactoryWithPrefetch' <p>
+   * \brief Aim: wraps an image factory so that images can be requested in
+   * the background before they are actually needed.
+   *
+   * The function 'prefetch' starts loading the image of a given domain
+   * in a background thread. A subsequent call to 'requestImage' with the
+   * same domain returns the prefetched image (waiting for the end of the
+   * loading if needed) instead of loading it again. At most one prefetch is
+   * pending at a time: prefetching another domain, or requesting an image
+   * of another domain, discards the pending one.
+   *
+   * All the calls to the underlying factory are serialized: 'requestImage',
+   * 'flushImage' and 'detachImage' wait for the pending prefetch to be
+   * done before using the underlying factory, so the latter does not need
+   * to be thread-safe (e.g. ImageFactoryFromHDF5). When the factory is
+   * shared under a lock, 'pendingPrefetch' gives the prefetch that
+   * 'prefetch' would wait for, so that it can be waited for without
+   * holding the lock (see TiledImage).
+   *
+   * Used as the factory of a TiledImage, the TiledIterator prefetches the
+   * next tile in lexicographic order while the current one is scanned.
+   * Note that the prefetched image is held by this factory and is not
+   * accounted in the cache of the TiledImage.
+   *
+   * @tparam TImageFactory an image factory type (model of CImageFactory).
+   */
+  template <typename TImageFactory>
+  class ImageFactoryWithPrefetch
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryWithPrefetch<TImageFactory> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));
+
+    ///Types copied from the factory
+    typedef TImageFactory ImageFactory;
+    typedef typename ImageFactory::Domain Domain;
+    typedef typename ImageFactory::OutputImage OutputImage;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the underlying image factory.
+     */
+    ImageFactoryWithPrefetch(Alias<ImageFactory> anImageFactory):
+      myImageFactoryPtr(&anImageFactory), myNbPrefetch(0), myNbPrefetchHit(0)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Waits for the pending prefetch and detaches its image.
+     */
+    ~ImageFactoryWithPrefetch()
+    {
+      discardPrefetch();
+    }
+
+  private:
+
+    ImageFactoryWithPrefetch( const ImageFactoryWithPrefetch & other );
+
+    ImageFactoryWithPrefetch & operator=( const ImageFactoryWithPrefetch & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImageFactoryPtr->domain();
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return (myImageFactoryPtr->isValid());
+    }
+
+    /**
+     * Starts loading in the background the image of the domain aDomain.
+     * Does nothing if this domain is already being prefetched.
+     *
+     * @param aDomain the domain.
+     */
+    void prefetch(const Domain &aDomain);
+
+    /**
+     * Returns the prefetch that a call to prefetch(aDomain) would wait
+     * for: the pending prefetch of another domain if its image is still
+     * loading, an invalid future otherwise. The returned future can be
+     * waited for while other threads use this factory.
+     *
+     * @param aDomain the domain.
+     *
+     * @return the pending prefetch or an invalid future.
+     */
+    std::shared_future<OutputImage *> pendingPrefetch(const Domain &aDomain) const;
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain aDomain,
+     * the prefetched one if any.
+     *
+     * @param aDomain the domain.
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain);
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage(OutputImage* outputImage);
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage);
+
+    /**
+     * @return the number of prefetches started.
+     */
+    unsigned int getNbPrefetch() const
+    {
+      return myNbPrefetch;
+    }
+
+    /**
+     * @return the number of requested images that were prefetched.
+     */
+    unsigned int getNbPrefetchHit() const
+    {
+      return myNbPrefetchHit;
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Waits for the pending prefetch, if any, to be done.
+     */
+    void waitPrefetch();
+
+    /**
+     * Waits for the pending prefetch, if any, and detaches its image.
+     */
+    void discardPrefetch();
+
+    /**
+     * Waits for the pending prefetch and takes its image.
+     *
+     * @return the prefetched image.
+     */
+    OutputImage * takePrefetch();
+
+    /**
+     * @param aDomain a domain.
+     * @return 'true' if aDomain is the domain being prefetched.
+     */
+    bool isPrefetched(const Domain &aDomain) const
+    {
+      return myPrefetch.valid()
+        && (myPrefetchDomain.lowerBound() == aDomain.lowerBound())
+        && (myPrefetchDomain.upperBound() == aDomain.upperBound());
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  protected:
+
+    /// Alias on the underlying image factory
+    ImageFactory * myImageFactoryPtr;
+
+    /// Pending prefetch (not valid if none)
+    std::shared_future<OutputImage *> myPrefetch;
+
+    /// Domain of the pending prefetch
+    Domain myPrefetchDomain;
+
+    /// Number of prefetches started
+    unsigned int myNbPrefetch;
+
+    /// Number of requested images that were prefetched
+    unsigned int myNbPrefetchHit;
+
+  }; // end of class ImageFactoryWithPrefetch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryWithPrefetch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryWithPrefetch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageFactory>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryWithPrefetch<TImageFactory> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryWithPrefetch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryWithPrefetch_h
+
+#undef ImageFactoryWithPrefetch_RECURSES
+#endif // else defined(ImageFactoryWithPrefetch_RECURSES)
@@ -56,6 +56,7 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -147,6 +148,44 @@ namespace DGtal
 		    const typename I::Value& low,
 		    const typename I::Value& up); 
 
+  /**
+   * Same as setFromImage above for images stored in a vector, whose
+   * values are read row by row (see
+   * ImageContainerBySTLVector::forEachRow) instead of point by point.
+   *
+   * @param aImg an image stored in a vector
+   * @param ito set inserter
+   * @param aThreshold any value (default: 0)
+   *
+   * @tparam D the domain of the image
+   * @tparam V the type of the values of the image
+   * @tparam O any model of output iterator
+   */
+  template<typename D, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    const O& ito, 
+		    const typename ImageContainerBySTLVector<D,V>::Value& aThreshold = 0); 
+
+  /**
+   * Same as setFromImage above for images stored in a vector, whose
+   * values are read row by row (see
+   * ImageContainerBySTLVector::forEachRow) instead of point by point.
+   *
+   * @param aImg an image stored in a vector
+   * @param ito set inserter
+   * @param low lower value
+   * @param up upper value
+   *
+   * @tparam D the domain of the image
+   * @tparam V the type of the values of the image
+   * @tparam O any model of output iterator
+   */
+  template<typename D, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    const O& ito, 
+		    const typename ImageContainerBySTLVector<D,V>::Value& low,
+		    const typename ImageContainerBySTLVector<D,V>::Value& up); 
+
 
   /**
    * Set the values of @a aImg at @a aValue
@@ -192,6 +231,21 @@ namespace DGtal
   template<typename I, typename F>
   void imageFromFunctor(I& aImg, const F& aFun); 
 
+  /**
+   * Same as imageFromFunctor above for images stored in a vector,
+   * whose values are written row by row (see
+   * ImageContainerBySTLVector::forEachRow).
+   *
+   * @param aImg (returned) image stored in a vector
+   * @param aFun a unary functor
+   *
+   * @tparam D the domain of the image
+   * @tparam V the type of the values of the image
+   * @tparam F any model of CPointFunctor
+   */
+  template<typename D, typename V, typename F>
+  void imageFromFunctor(ImageContainerBySTLVector<D,V>& aImg, const F& aFun); 
+
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <future>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -57,6 +58,53 @@
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /**
+     * Asks anImageFactory to load in the background the image of the domain
+     * aDomain, when the factory provides a 'prefetch' method (see
+     * ImageFactoryWithPrefetch).
+     *
+     * @param anImageFactory the image factory.
+     * @param aDomain the domain.
+     */
+    template <typename TImageFactory, typename TDomain>
+    auto tiledImagePrefetch(TImageFactory & anImageFactory, const TDomain & aDomain, int)
+      -> decltype(anImageFactory.prefetch(aDomain), void())
+    {
+      anImageFactory.prefetch(aDomain);
+    }
+
+    /// Overload for image factories without 'prefetch': does nothing.
+    template <typename TImageFactory, typename TDomain>
+    void tiledImagePrefetch(TImageFactory &, const TDomain &, long)
+    {
+    }
+
+    /**
+     * Returns the pending prefetch that a prefetch of the domain aDomain
+     * would wait for, when the factory provides a 'pendingPrefetch' method
+     * (see ImageFactoryWithPrefetch).
+     *
+     * @param anImageFactory the image factory.
+     * @param aDomain the domain.
+     * @return the pending prefetch or an invalid future.
+     */
+    template <typename TImageFactory, typename TDomain>
+    auto tiledImagePendingPrefetch(TImageFactory & anImageFactory, const TDomain & aDomain, int)
+      -> decltype(anImageFactory.pendingPrefetch(aDomain))
+    {
+      return anImageFactory.pendingPrefetch(aDomain);
+    }
+
+    /// Overload for image factories without 'pendingPrefetch': returns an invalid future.
+    template <typename TImageFactory, typename TDomain>
+    std::shared_future<void> tiledImagePendingPrefetch(TImageFactory &, const TDomain &, long)
+    {
+      return std::shared_future<void>();
+    }
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // Template class TiledImage
   /**
@@ -71,6 +119,18 @@ namespace DGtal
    * @note It is important to take into account that read and write policies are passed as aliases in the TiledImage constructor,
    * so for example, if two TiledImage instances are successively created with the same read policy instance,
    * the state of the cache for a given time is therefore the same for the two TiledImage instances !
+   *
+   * @note When the image factory provides a 'prefetch' method (see ImageFactoryWithPrefetch), the
+   * TiledIterator asks for the next tile of the traversal to be loaded in the background while
+   * the current tile is scanned. Combined with ImageCacheReadPolicyLRU, this bounds the memory used
+   * by the tiles and hides most of the loading time when streaming a large image.
+   *
+   * @note In concurrent access mode (see setConcurrentAccess), a TiledImage can be shared between
+   * threads: the accesses to the cache are serialized and each TiledIterator pins its current tile,
+   * so that the tile is not detached while it is scanned, even if another thread makes the cache
+   * replace it; such a tile is still the one used for its block until it is unpinned. Iterators
+   * read and write the pinned tiles without locking the cache, so two threads writing the same
+   * points, or one writing points that another reads, must synchronize themselves.
    */
   template <typename TImageContainer, typename TImageFactory, typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
   class TiledImage
@@ -153,6 +213,7 @@ namespace DGtal
       myWritePolicy = other.myWritePolicy;
 
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
+      myImageCache->setConcurrentAccess(other.isConcurrentAccess());
 
       m_lowerBound = myImageFactory->domain().lowerBound();
       m_upperBound = myImageFactory->domain().upperBound();
@@ -176,6 +237,7 @@ namespace DGtal
           myWritePolicy = other.myWritePolicy;
 
           myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
+          myImageCache->setConcurrentAccess(other.isConcurrentAccess());
 
           m_lowerBound = myImageFactory->domain().lowerBound();
           m_upperBound = myImageFactory->domain().upperBound();
@@ -256,12 +318,15 @@ namespace DGtal
       TiledIterator ( BlockCoordsIterator aBlockCoordsIterator,
                       const TiledImage<ImageContainer, ImageFactory,
                       ImageCacheReadPolicy, ImageCacheWritePolicy> *aTiledImage ) :  myTiledImage ( aTiledImage ),
-                                                                                     myBlockCoordsIterator ( aBlockCoordsIterator )
+                                                                                     myTile ( NULL ),
+                                                                                     myBlockCoordsIterator ( aBlockCoordsIterator ),
+                                                                                     myPinned ( false )
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            setTile();
             myTiledRangeIterator = myTile->range().begin();
+            prefetchNext();
           }
       }
 
@@ -276,13 +341,64 @@ namespace DGtal
                       const Point& aPoint,
                       const TiledImage<ImageContainer, ImageFactory,
                       ImageCacheReadPolicy, ImageCacheWritePolicy> *aTiledImage ) :  myTiledImage ( aTiledImage ),
-                                                                                     myBlockCoordsIterator ( aBlockCoordsIterator )
+                                                                                     myTile ( NULL ),
+                                                                                     myBlockCoordsIterator ( aBlockCoordsIterator ),
+                                                                                     myPinned ( false )
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            setTile();
             myTiledRangeIterator = myTile->range().begin(aPoint);
+            prefetchNext();
+          }
+      }
+
+      /**
+       * Copy constructor. The tile of other is pinned again.
+       *
+       * @param other the TiledIterator to clone.
+       */
+      TiledIterator ( const TiledIterator & other ) : myTiledImage ( other.myTiledImage ),
+                                                      myTile ( other.myTile ),
+                                                      myTiledRangeIterator ( other.myTiledRangeIterator ),
+                                                      myBlockCoordsIterator ( other.myBlockCoordsIterator ),
+                                                      myPinned ( other.myPinned )
+      {
+        if ( myPinned )
+          myTiledImage->pinTile( myTile );
+      }
+
+      /**
+       * Assignment.
+       *
+       * @param other the TiledIterator to copy.
+       * @return a reference on 'this'.
+       */
+      TiledIterator & operator= ( const TiledIterator & other )
+      {
+        if ( this != &other )
+          {
+            if ( other.myPinned )
+              other.myTiledImage->pinTile( other.myTile );
+            if ( myPinned )
+              myTiledImage->unpinTile( myTile );
+
+            myTiledImage = other.myTiledImage;
+            myTile = other.myTile;
+            myTiledRangeIterator = other.myTiledRangeIterator;
+            myBlockCoordsIterator = other.myBlockCoordsIterator;
+            myPinned = other.myPinned;
           }
+        return *this;
+      }
+
+      /**
+       * Destructor. Unpins the current tile.
+       */
+      ~TiledIterator()
+      {
+        if ( myPinned )
+          myTiledImage->unpinTile( myTile );
       }
 
       /**
@@ -339,8 +455,9 @@ namespace DGtal
             if ( myBlockCoordsIterator == myTiledImage->domainBlockCoords().end() )
               return;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            setTile();
             myTiledRangeIterator = myTile->range().begin();
+            prefetchNext();
           }
       }
 
@@ -379,7 +496,8 @@ namespace DGtal
           {
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            setTile();
+            prefetchPrevious();
 
             myTiledRangeIterator = myTile->range().end();
             myTiledRangeIterator--;
@@ -402,7 +520,8 @@ namespace DGtal
 
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            setTile();
+            prefetchPrevious();
 
             myTiledRangeIterator = myTile->range().end();
             myTiledRangeIterator--;
@@ -432,6 +551,46 @@ namespace DGtal
       }
 
     private:
+      /**
+       * Sets the current tile from the current block coords. In concurrent
+       * access mode, the previous tile is unpinned and the new one is pinned.
+       */
+      void setTile()
+      {
+        if ( myPinned )
+          myTiledImage->unpinTile( myTile );
+
+        myPinned = myTiledImage->isConcurrentAccess();
+        if ( myPinned )
+          myTile = myTiledImage->pinTileFromBlockCoords( (*myBlockCoordsIterator) );
+        else
+          myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+      }
+
+      /**
+       * Prefetches the tile following the current one in lexicographic order.
+       */
+      void prefetchNext() const
+      {
+        BlockCoordsIterator it = myBlockCoordsIterator;
+        ++it;
+        if ( it != myTiledImage->domainBlockCoords().end() )
+          myTiledImage->prefetchTileFromBlockCoords( *it );
+      }
+
+      /**
+       * Prefetches the tile preceding the current one in lexicographic order.
+       */
+      void prefetchPrevious() const
+      {
+        if ( myBlockCoordsIterator == myTiledImage->domainBlockCoords().begin() )
+          return;
+
+        BlockCoordsIterator it = myBlockCoordsIterator;
+        --it;
+        myTiledImage->prefetchTileFromBlockCoords( *it );
+      }
+
       /// TiledImage pointer
       const TiledImage *myTiledImage;
 
@@ -443,6 +602,9 @@ namespace DGtal
 
       /// Current block coords iterator
       BlockCoordsIterator myBlockCoordsIterator;
+
+      /// 'true' if the current tile is pinned
+      bool myPinned;
     };
 
 
@@ -684,16 +846,81 @@ namespace DGtal
     {
       ASSERT(domainBlockCoords().isInside(aCoord));
 
+      typename MyImageCache::Lock lock( *myImageCache );
+      return loadTile( findSubDomainFromBlockCoords( aCoord ) );
+    }
+
+    /**
+     * Returns an ImageContainer pointer for the block coords aCoord
+     * and pins it: the tile stays in memory until it is unpinned.
+     *
+     * @param aCoord the block coords.
+     * @return an ImageContainer pointer.
+     */
+    ImageContainer * pinTileFromBlockCoords(const Point & aCoord) const
+    {
+      ASSERT(domainBlockCoords().isInside(aCoord));
+
+      typename MyImageCache::Lock lock( *myImageCache );
+      ImageContainer *tile = loadTile( findSubDomainFromBlockCoords( aCoord ) );
+      myImageCache->pinPage(tile);
+
+      return tile;
+    }
+
+    /**
+     * Pins again a pinned tile.
+     *
+     * @param aTile a pinned tile.
+     */
+    void pinTile(ImageContainer * aTile) const
+    {
+      typename MyImageCache::Lock lock( *myImageCache );
+      myImageCache->pinPage(aTile);
+    }
+
+    /**
+     * Unpins a tile.
+     *
+     * @param aTile a pinned tile.
+     */
+    void unpinTile(ImageContainer * aTile) const
+    {
+      typename MyImageCache::Lock lock( *myImageCache );
+      myImageCache->unpinPage(aTile);
+    }
+
+    /**
+     * Asks the image factory to load in the background the tile with
+     * the block coords aCoord if it is not in the cache yet.
+     * Does nothing if the image factory has no 'prefetch' method.
+     * The end of a prefetch still in progress is waited for without
+     * holding the lock of the cache.
+     *
+     * @param aCoord the block coords.
+     */
+    void prefetchTileFromBlockCoords(const Point & aCoord) const
+    {
+      ASSERT(domainBlockCoords().isInside(aCoord));
+
       Domain d = findSubDomainFromBlockCoords( aCoord );
-      ImageContainer *tile = myImageCache->getPage(d);
-      if (!tile)
+      for (;;)
+      {
+        decltype(detail::tiledImagePendingPrefetch(*myImageFactory, d, 0)) pending;
         {
-          myImageCache->incCacheMissRead();
-          myImageCache->update(d);
-          tile = myImageCache->getPage(d);
-        }
+          typename MyImageCache::Lock lock( *myImageCache );
+          if (myImageCache->findPage(d))
+            return;
 
-      return tile;
+          pending = detail::tiledImagePendingPrefetch(*myImageFactory, d, 0);
+          if (!pending.valid())
+          {
+            detail::tiledImagePrefetch(*myImageFactory, d, 0);
+            return;
+          }
+        }
+        pending.wait();
+      }
     }
 
     /**
@@ -709,10 +936,14 @@ namespace DGtal
       typename OutputImage::Value aValue;
       bool res;
 
+      typename MyImageCache::Lock lock( *myImageCache );
       res = myImageCache->read(aPoint, aValue);
 
       if (res)
-        return aValue;
+        {
+          myImageCache->incCacheHitRead();
+          return aValue;
+        }
       else
         {
           myImageCache->incCacheMissRead();
@@ -743,8 +974,12 @@ namespace DGtal
     {
       ASSERT(myImageFactory->domain().isInside(aPoint));
 
+      typename MyImageCache::Lock lock( *myImageCache );
       if (myImageCache->write(aPoint, aValue))
-        return;
+        {
+          myImageCache->incCacheHitWrite();
+          return;
+        }
       else
         {
           myImageCache->incCacheMissWrite();
@@ -756,7 +991,7 @@ namespace DGtal
     /**
      * Get the cacheMissRead value.
      */
-    unsigned int getCacheMissRead()
+    DGtal::uint64_t getCacheMissRead()
     {
       return myImageCache->getCacheMissRead();
     }
@@ -764,13 +999,67 @@ namespace DGtal
     /**
      * Get the cacheMissWrite value.
      */
-    unsigned int getCacheMissWrite()
+    DGtal::uint64_t getCacheMissWrite()
     {
       return myImageCache->getCacheMissWrite();
     }
 
     /**
-     * Clear the cache and reset the cache misses
+     * Get the cacheHitRead value.
+     */
+    DGtal::uint64_t getCacheHitRead()
+    {
+      return myImageCache->getCacheHitRead();
+    }
+
+    /**
+     * Get the cacheHitWrite value.
+     */
+    DGtal::uint64_t getCacheHitWrite()
+    {
+      return myImageCache->getCacheHitWrite();
+    }
+
+    /**
+     * Get the number of bytes loaded into the cache.
+     */
+    DGtal::uint64_t getBytesLoaded()
+    {
+      return myImageCache->getBytesLoaded();
+    }
+
+    /**
+     * Enables or disables the concurrent access mode, in which the
+     * TiledImage can be shared between threads. It must not be changed
+     * while the TiledImage is used (e.g. while iterators exist).
+     *
+     * @param aConcurrent 'true' to enable the concurrent access mode.
+     */
+    void setConcurrentAccess(bool aConcurrent)
+    {
+      myImageCache->setConcurrentAccess(aConcurrent);
+    }
+
+    /**
+     * @return 'true' if the concurrent access mode is enabled.
+     */
+    bool isConcurrentAccess() const
+    {
+      return myImageCache->isConcurrentAccess();
+    }
+
+    /**
+     * Get the number of pinned tiles.
+     */
+    unsigned int getNbPinnedTiles() const
+    {
+      typename MyImageCache::Lock lock( *myImageCache );
+      return myImageCache->getNbPinnedPages();
+    }
+
+    /**
+     * Clear the cache and reset the cache misses, the cache hits and
+     * the number of bytes loaded.
      */
     void clearCacheAndResetCacheMisses()
     {
@@ -802,6 +1091,29 @@ namespace DGtal
     TImageCacheWritePolicy *myWritePolicy;
 
     // ------------------------- Internals ------------------------------------
+  protected:
+
+    /**
+     * Returns an ImageContainer pointer for the tile of domain aDomain,
+     * loading it in the cache if needed. The cache must be locked.
+     *
+     * @param aDomain the domain of the tile.
+     * @return an ImageContainer pointer.
+     */
+    ImageContainer * loadTile(const Domain & aDomain) const
+    {
+      ImageContainer *tile = myImageCache->getPage(aDomain);
+      if (!tile)
+        {
+          myImageCache->incCacheMissRead();
+          myImageCache->update(aDomain);
+          tile = myImageCache->getPage(aDomain);
+        }
+      else
+        myImageCache->incCacheHitRead();
+
+      return tile;
+    }
 
   }; // end of class TiledImage
 
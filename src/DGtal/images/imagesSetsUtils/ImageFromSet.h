@@ -41,14 +41,37 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <iterator>
+#include <type_traits>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /**
+     * Tells if the values of distinct points of an image of type @a
+     * TImage can be set concurrently (false by default).
+     * @tparam TImage a model of CImage.
+     */
+    template <typename TImage>
+    struct ImageHasConcurrentSetValue : public std::false_type {};
+
+    /**
+     * Values of images stored in a vector are distinct elements, except
+     * for vector<bool> whose values share words.
+     */
+    template <typename TDomain, typename TValue>
+    struct ImageHasConcurrentSetValue< ImageContainerBySTLVector<TDomain, TValue> >
+      : public std::integral_constant< bool, ! std::is_same<TValue, bool>::value > {};
+  } // namespace detail
 
   /////////////////////////////////////////////////////////////////////////////
   // template class ImageFromSet
@@ -153,6 +176,29 @@ namespace DGtal
     {
       append<Set>(aImage,defaultValue,aSet.begin(),aSet.end());
     }
+
+    /** 
+     * Append a Set to an existing image, the values being set in
+     * parallel. Only points in the Set contained in the image domain
+     * are considered. The points of sets whose iterators are not
+     * random access are first copied into a vector.
+     *
+     * The values are set in parallel only if they can be set
+     * concurrently (see detail::ImageHasConcurrentSetValue, e.g.
+     * ImageContainerBySTLVector with non bool values), otherwise this
+     * method is the same as append.
+     * 
+     * @tparam Set model of CDigitalSet
+     * @param aImage an image
+     * @param aSet  an instance of Set to convert into an image
+     * @param defaultValue the default value for points in the set
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     */
+    template<typename Set>
+    static
+    void appendParallel(Image &aImage, const Set &aSet, const Value &defaultValue,
+                        unsigned int nbThreads = 0);
   }   ; // end of class ImageFromSet
 
 
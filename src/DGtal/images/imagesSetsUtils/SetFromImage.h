@@ -41,9 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <unordered_set>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/images/IntervalForegroundPredicate.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -151,6 +156,55 @@ namespace DGtal
       append(aSet,aImage,isForeground);
     }
 
+    /** 
+     * Append an Image value set to an existing Set (maybe empty), the
+     * image being scanned in parallel. The rows of the image domain
+     * (see HyperRectDomain::forEachRow) are split into slabs of
+     * consecutive rows, each slab collecting its points in a local
+     * vector. The slabs are then merged into @a aSet in the order of
+     * the domain. When @a aSet is empty, the points are added with
+     * insertNew, so that a DigitalSetBySTLVector is simply the
+     * concatenation of the slabs.
+     *
+     * @pre the ForegroundPredicate instance must have been created on
+     * the image @a aImage, and must be callable concurrently.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set, whose domain is a HyperRectDomain.
+     * @param isForeground instance of ForegroundPredicate to decide
+     * which points to copy.
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     */
+    template<typename Image,typename ForegroundPredicate>
+    static
+    void appendParallel(Set &aSet, const Image &aImage,
+                        const ForegroundPredicate &isForeground,
+                        unsigned int nbThreads = 0);
+
+    /** 
+     * Append an Image value set to an existing Set (maybe empty), the
+     * image being scanned in parallel (see appendParallel above). The
+     * points are the ones whose values are in ]minVal,maxVal].
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set, whose domain is a HyperRectDomain.
+     * @param minVal minimum value of the thresholding
+     * @param maxVal maximum value of the thresholding
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     */
+    template<typename Image>
+    static
+    void appendParallel(Set &aSet, const Image &aImage, 
+                        const typename Image::Value minVal,
+                        const typename Image::Value maxVal,
+                        unsigned int nbThreads = 0)
+    {
+      functors::IntervalForegroundPredicate<Image> isForeground(aImage,minVal,maxVal);
+      appendParallel(aSet,aImage,isForeground,nbThreads);
+    }
+
   };
 } // namespace DGtal
 
@@ -0,0 +1,350 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file ChunkedZlib.cpp
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Implementation of methods defined in ChunkedZlib.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <limits>
+#include <zlib.h>
+#include "DGtal/io/ChunkedZlib.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ParallelFor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+// class ChunkedZlibWriter
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::ChunkedZlibWriter::ChunkedZlibWriter( std::ostream & out, std::size_t aChunkSize,
+                                             unsigned int nbThreads, int aLevel )
+  : myOut( out ), myChunkSize( aChunkSize ), myNbThreads( nbThreads ), myLevel( aLevel ),
+    myChecksum( adler32( 0L, Z_NULL, 0 ) ), mySize( 0 ), myIsClosed( false )
+{
+  ASSERT( aChunkSize > 0 && aChunkSize <= std::numeric_limits<uInt>::max() );
+  if ( myNbThreads == 0 )
+    myNbThreads = functions::parallelNbThreads();
+  myBuffer.reserve( myChunkSize );
+
+  // zlib header: deflate with a 32K window, no preset dictionary.
+  myOut.put( static_cast<char>( 0x78 ) );
+  myOut.put( static_cast<char>( 0x9c ) );
+}
+
+DGtal::ChunkedZlibWriter::~ChunkedZlibWriter()
+{
+  if ( ! myIsClosed )
+    {
+      try
+        {
+          close();
+        }
+      catch ( ... )
+        {
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::ChunkedZlibWriter::write( const char * data, std::size_t n )
+{
+  ASSERT( ! myIsClosed );
+  while ( n > 0 )
+    {
+      // A full chunk is only compressed once we know that it is not the last one.
+      if ( myBuffer.size() == myChunkSize )
+        submitChunk( false );
+
+      const std::size_t nbBytes = std::min( n, myChunkSize - myBuffer.size() );
+      myBuffer.append( data, nbBytes );
+      data  += nbBytes;
+      n     -= nbBytes;
+      mySize += nbBytes;
+    }
+}
+
+void
+DGtal::ChunkedZlibWriter::close()
+{
+  if ( myIsClosed )
+    return;
+  myIsClosed = true;
+
+  submitChunk( true );
+  while ( ! myPending.empty() )
+    writeOldestChunk();
+
+  // adler32 checksum, big-endian as required by zlib.
+  for ( int shift = 24; shift >= 0; shift -= 8 )
+    myOut.put( static_cast<char>( ( myChecksum >> shift ) & 0xFF ) );
+
+  // Chunk index, little-endian.
+  for ( DGtal::uint64_t chunkSize : myChunkSizes )
+    for ( unsigned int i = 0; i < 8; ++i, chunkSize >>= 8 )
+      myOut.put( static_cast<char>( chunkSize & 0xFF ) );
+
+  myOut.flush();
+  if ( ! myOut )
+    {
+      trace.error() << "ChunkedZlibWriter: can't write the stream" << std::endl;
+      throw IOException();
+    }
+}
+
+void
+DGtal::ChunkedZlibWriter::selfDisplay ( std::ostream & out ) const
+{
+  out << "[ChunkedZlibWriter] chunkSize=" << myChunkSize
+      << " threads=" << myNbThreads
+      << " size=" << mySize
+      << " chunks=" << myChunkSizes.size() + myPending.size()
+      << ( myIsClosed ? " closed" : "" );
+}
+
+bool
+DGtal::ChunkedZlibWriter::isValid() const
+{
+  return myChunkSize > 0 && myNbThreads > 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internals - private :
+
+void
+DGtal::ChunkedZlibWriter::submitChunk( bool isLast )
+{
+  if ( myPending.size() >= myNbThreads )
+    writeOldestChunk();
+
+  std::string chunk;
+  chunk.swap( myBuffer );
+  if ( ! isLast )
+    myBuffer.reserve( myChunkSize );
+
+  const int level = myLevel;
+  myPending.push_back( std::async( std::launch::async,
+                                   [ chunk = std::move( chunk ), level, isLast ] ()
+                                   { return compress( chunk, level, isLast ); } ) );
+}
+
+void
+DGtal::ChunkedZlibWriter::writeOldestChunk()
+{
+  // Rethrows the exception of the compression, if any.
+  const CompressedChunk chunk = myPending.front().get();
+  myPending.pop_front();
+
+  myOut.write( chunk.data.data(), chunk.data.size() );
+  if ( ! myOut )
+    {
+      trace.error() << "ChunkedZlibWriter: can't write the stream" << std::endl;
+      throw IOException();
+    }
+  myChunkSizes.push_back( chunk.data.size() );
+  myChecksum = adler32_combine( myChecksum, chunk.checksum, static_cast<z_off_t>( chunk.size ) );
+}
+
+DGtal::ChunkedZlibWriter::CompressedChunk
+DGtal::ChunkedZlibWriter::compress( const std::string & data, int aLevel, bool isLast )
+{
+  CompressedChunk chunk;
+  chunk.size = data.size();
+  chunk.checksum = adler32( adler32( 0L, Z_NULL, 0 ),
+                            reinterpret_cast<const Bytef*>( data.data() ),
+                            static_cast<uInt>( data.size() ) );
+
+  z_stream stream;
+  stream.zalloc = Z_NULL;
+  stream.zfree  = Z_NULL;
+  stream.opaque = Z_NULL;
+  // Raw deflate (negative window bits): the zlib header and checksum
+  // are written once for the whole stream.
+  if ( deflateInit2( &stream, aLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY ) != Z_OK )
+    {
+      trace.error() << "ChunkedZlibWriter: can't initialize zlib" << std::endl;
+      throw IOException();
+    }
+
+  stream.next_in  = reinterpret_cast<Bytef*>( const_cast<char*>( data.data() ) );
+  stream.avail_in = static_cast<uInt>( data.size() );
+
+  // A sync flush ends the chunk on a byte boundary without ending the stream.
+  const int flush = isLast ? Z_FINISH : Z_SYNC_FLUSH;
+  chunk.data.resize( deflateBound( &stream, stream.avail_in ) + 16 );
+  int ret;
+  for ( ;; )
+    {
+      if ( stream.total_out == chunk.data.size() )
+        chunk.data.resize( 2 * chunk.data.size() );
+      stream.next_out  = reinterpret_cast<Bytef*>( &chunk.data[ stream.total_out ] );
+      stream.avail_out = static_cast<uInt>( chunk.data.size() - stream.total_out );
+      ret = deflate( &stream, flush );
+      if ( ( ret != Z_OK ) && ( ret != Z_BUF_ERROR ) && ( ret != Z_STREAM_END ) )
+        break;
+      if ( isLast ? ( ret == Z_STREAM_END ) : ( stream.avail_out != 0 ) )
+        break;
+    }
+  chunk.data.resize( stream.total_out );
+  deflateEnd( &stream );
+
+  if ( ( ret != Z_OK ) && ( ret != Z_STREAM_END ) )
+    {
+      trace.error() << "ChunkedZlibWriter: zlib error " << ret << std::endl;
+      throw IOException();
+    }
+  return chunk;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// class ChunkedZlibReader
+///////////////////////////////////////////////////////////////////////////////
+
+std::size_t
+DGtal::ChunkedZlibReader::nbChunks( DGtal::uint64_t aSize, std::size_t aChunkSize )
+{
+  // An empty stream has one empty chunk.
+  return aSize == 0 ? 1 : static_cast<std::size_t>( ( aSize + aChunkSize - 1 ) / aChunkSize );
+}
+
+void
+DGtal::ChunkedZlibReader::decompress( const char * data, std::size_t n,
+                                      std::size_t aChunkSize,
+                                      char * out, std::size_t outSize,
+                                      unsigned int nbThreads )
+{
+  const unsigned char * bytes = reinterpret_cast<const unsigned char*>( data );
+  const std::size_t nb = nbChunks( outSize, aChunkSize );
+  const std::size_t indexSize = 8 * nb;
+
+  if ( ( n < 2 + 4 + indexSize )
+       || ( ( bytes[ 0 ] & 0x0f ) != 8 ) || ( ( bytes[ 1 ] & 0x20 ) != 0 )
+       || ( ( bytes[ 0 ] * 256 + bytes[ 1 ] ) % 31 != 0 ) )
+    {
+      trace.error() << "ChunkedZlibReader: invalid zlib header" << std::endl;
+      throw IOException();
+    }
+
+  // Chunk offsets from the index. Each chunk must lie between the
+  // zlib header and the checksum, so that the offsets cannot wrap.
+  const std::size_t end = n - 4 - indexSize;
+  std::vector<std::size_t> offsets( nb + 1 );
+  offsets[ 0 ] = 2;
+  for ( std::size_t i = 0; i < nb; ++i )
+    {
+      DGtal::uint64_t chunkSize = 0;
+      for ( unsigned int b = 8; b > 0; --b )
+        chunkSize = ( chunkSize << 8 ) | bytes[ n - indexSize + 8 * i + b - 1 ];
+      if ( chunkSize > end - offsets[ i ] )
+        {
+          trace.error() << "ChunkedZlibReader: invalid chunk index" << std::endl;
+          throw IOException();
+        }
+      offsets[ i + 1 ] = offsets[ i ] + static_cast<std::size_t>( chunkSize );
+    }
+  if ( offsets[ nb ] != end )
+    {
+      trace.error() << "ChunkedZlibReader: invalid chunk index" << std::endl;
+      throw IOException();
+    }
+
+  std::vector<unsigned long> checksums( nb );
+  std::atomic<bool> isValid( true );
+  functions::parallelFor( 0, nb, [&] ( std::size_t i )
+    {
+      const bool isLast = ( i + 1 == nb );
+      const std::size_t first = i * aChunkSize;
+      const std::size_t size  = std::min( outSize - std::min( outSize, first ), aChunkSize );
+
+      z_stream stream;
+      stream.zalloc = Z_NULL;
+      stream.zfree  = Z_NULL;
+      stream.opaque = Z_NULL;
+      stream.next_in  = Z_NULL;
+      stream.avail_in = 0;
+      if ( inflateInit2( &stream, -15 ) != Z_OK )
+        {
+          isValid = false;
+          return;
+        }
+      stream.next_in   = const_cast<Bytef*>( bytes + offsets[ i ] );
+      stream.avail_in  = static_cast<uInt>( offsets[ i + 1 ] - offsets[ i ] );
+      stream.next_out  = reinterpret_cast<Bytef*>( out + first );
+      stream.avail_out = static_cast<uInt>( size );
+      const int ret = inflate( &stream, Z_SYNC_FLUSH );
+      inflateEnd( &stream );
+
+      // Each chunk must exactly fill its part of the output.
+      if ( ( isLast ? ( ret != Z_STREAM_END ) : ( ret != Z_OK ) )
+           || ( stream.avail_out != 0 ) || ( stream.avail_in != 0 ) )
+        {
+          isValid = false;
+          return;
+        }
+      checksums[ i ] = adler32( adler32( 0L, Z_NULL, 0 ),
+                                reinterpret_cast<const Bytef*>( out + first ),
+                                static_cast<uInt>( size ) );
+    }, nbThreads );
+
+  if ( ! isValid )
+    {
+      trace.error() << "ChunkedZlibReader: invalid compressed data" << std::endl;
+      throw IOException();
+    }
+
+  unsigned long checksum = adler32( 0L, Z_NULL, 0 );
+  for ( std::size_t i = 0; i < nb; ++i )
+    checksum = adler32_combine( checksum, checksums[ i ],
+                                static_cast<z_off_t>( std::min( outSize - std::min( outSize, i * aChunkSize ),
+                                                                aChunkSize ) ) );
+  unsigned long expected = 0;
+  for ( unsigned int b = 0; b < 4; ++b )
+    expected = ( expected << 8 ) | bytes[ offsets[ nb ] + b ];
+  if ( checksum != expected )
+    {
+      trace.error() << "ChunkedZlibReader: checksum error" << std::endl;
+      throw IOException();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation of inline functions and external operators                 //
+
+std::ostream&
+DGtal::operator<< ( std::ostream & out, const ChunkedZlibWriter & object )
+{
+  object.selfDisplay( out );
+  return out;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
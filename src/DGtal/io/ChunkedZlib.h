@@ -0,0 +1,289 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkedZlib.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ChunkedZlib.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkedZlib_RECURSES)
+#error Recursive header files inclusion detected in ChunkedZlib.h
+#else // defined(ChunkedZlib_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkedZlib_RECURSES
+
+#if !defined ChunkedZlib_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkedZlib_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <future>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ChunkedZlibWriter
+  /**
+   * Description of class 'ChunkedZlibWriter' <p>
+   * \brief Aim: writes a zlib stream made of independently compressed
+   * chunks, the chunks being compressed in parallel.
+   *
+   * The data is cut into chunks of chunkSize() bytes (the last one may
+   * be shorter). Each chunk is compressed by its own deflate stream and
+   * ends on a byte boundary, so that the concatenation of the
+   * compressed chunks, preceded by a zlib header and followed by the
+   * adler32 checksum of the whole data, is a standard zlib stream: it
+   * can be decompressed in one pass by any zlib decompressor. The
+   * compressed size of each chunk is then appended after the stream,
+   * as little-endian 64 bits integers, so that ChunkedZlibReader can
+   * decompress the chunks in parallel.
+   *
+   * The data is given incrementally with write(): full chunks are
+   * compressed in the background while the next ones are produced, and
+   * written in order to the output stream. At most nbThreads chunks are
+   * compressed at the same time, which also bounds the memory used.
+   *
+   * @code
+   * std::ofstream out( "data.z", std::ios::binary );
+   * ChunkedZlibWriter writer( out, 1 << 20 );
+   * for ( ... )
+   *   writer.write( slice.data(), slice.size() );
+   * writer.close();
+   * @endcode
+   *
+   * @see ChunkedZlibReader, VolWriter, LongvolWriter, VolSliceWriter
+   */
+  class ChunkedZlibWriter
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Writes the zlib header to out.
+     *
+     * @param out the output stream (must be opened in binary mode).
+     * @param aChunkSize the number of uncompressed bytes per chunk (at least 1).
+     * @param nbThreads the maximal number of chunks compressed at the
+     * same time, 0 (default) means functions::parallelNbThreads().
+     * @param aLevel the zlib compression level (-1 means the zlib default).
+     */
+    ChunkedZlibWriter( std::ostream & out, std::size_t aChunkSize,
+                       unsigned int nbThreads = 0, int aLevel = -1 );
+
+    /**
+     * Destructor. Closes the stream if close() has not been called,
+     * errors are then ignored.
+     */
+    ~ChunkedZlibWriter();
+
+  private:
+
+    ChunkedZlibWriter( const ChunkedZlibWriter & other );
+
+    ChunkedZlibWriter & operator=( const ChunkedZlibWriter & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Appends some data to the stream.
+     *
+     * @param data the first byte of the data.
+     * @param n the number of bytes.
+     * @throw IOException if a chunk cannot be compressed or written.
+     */
+    void write( const char * data, std::size_t n );
+
+    /**
+     * Compresses the last chunk, waits for all the chunks and writes
+     * the checksum and the chunk sizes. Does nothing if the stream is
+     * already closed.
+     *
+     * @throw IOException if a chunk cannot be compressed or written.
+     */
+    void close();
+
+    /**
+     * @return the number of uncompressed bytes per chunk.
+     */
+    std::size_t chunkSize() const
+    {
+      return myChunkSize;
+    }
+
+    /**
+     * @return the number of uncompressed bytes written so far.
+     */
+    DGtal::uint64_t size() const
+    {
+      return mySize;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A compressed chunk
+    struct CompressedChunk
+    {
+      /// Raw deflate data
+      std::string data;
+      /// adler32 checksum of the uncompressed data
+      unsigned long checksum;
+      /// Size of the uncompressed data
+      std::size_t size;
+    };
+
+    /// Output stream
+    std::ostream & myOut;
+
+    /// Number of uncompressed bytes per chunk
+    std::size_t myChunkSize;
+
+    /// Maximal number of chunks compressed at the same time
+    unsigned int myNbThreads;
+
+    /// zlib compression level
+    int myLevel;
+
+    /// Uncompressed data of the current chunk
+    std::string myBuffer;
+
+    /// Chunks being compressed, in the stream order
+    std::deque< std::future<CompressedChunk> > myPending;
+
+    /// Compressed size of the chunks written so far
+    std::vector<DGtal::uint64_t> myChunkSizes;
+
+    /// adler32 checksum of the chunks written so far
+    unsigned long myChecksum;
+
+    /// Number of uncompressed bytes written so far
+    DGtal::uint64_t mySize;
+
+    /// 'true' once close() has been called
+    bool myIsClosed;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Starts the compression of the current chunk.
+     * @param isLast 'true' if it is the last chunk of the stream.
+     */
+    void submitChunk( bool isLast );
+
+    /**
+     * Waits for the oldest chunk being compressed and writes it.
+     */
+    void writeOldestChunk();
+
+    /**
+     * Compresses a chunk with a raw deflate stream.
+     * @param data the uncompressed data.
+     * @param aLevel the compression level.
+     * @param isLast 'true' if it is the last chunk of the stream.
+     * @return the compressed chunk.
+     */
+    static CompressedChunk compress( const std::string & data, int aLevel, bool isLast );
+
+  }; // end of class ChunkedZlibWriter
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ChunkedZlibReader
+  /**
+   * Description of class 'ChunkedZlibReader' <p>
+   * \brief Aim: decompresses in parallel the streams written by
+   * ChunkedZlibWriter.
+   *
+   * @see ChunkedZlibWriter
+   */
+  struct ChunkedZlibReader
+  {
+    /**
+     * @param aSize the number of uncompressed bytes.
+     * @param aChunkSize the number of uncompressed bytes per chunk.
+     * @return the number of chunks of a stream.
+     */
+    static std::size_t nbChunks( DGtal::uint64_t aSize, std::size_t aChunkSize );
+
+    /**
+     * Decompresses a stream written by ChunkedZlibWriter, the chunks
+     * being decompressed in parallel.
+     *
+     * @param data the first byte of the stream (zlib header).
+     * @param n the number of bytes of the stream, chunk sizes included.
+     * @param aChunkSize the number of uncompressed bytes per chunk.
+     * @param out the first byte of the uncompressed data.
+     * @param outSize the number of uncompressed bytes.
+     * @param nbThreads the maximal number of threads, 0 (default) means
+     * functions::parallelNbThreads().
+     * @throw IOException if the stream is invalid.
+     */
+    static void decompress( const char * data, std::size_t n,
+                            std::size_t aChunkSize,
+                            char * out, std::size_t outSize,
+                            unsigned int nbThreads = 0 );
+  }; // end of struct ChunkedZlibReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChunkedZlibWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChunkedZlibWriter' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const ChunkedZlibWriter & object );
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkedZlib_h
+
+#undef ChunkedZlib_RECURSES
+#endif // else defined(ChunkedZlib_RECURSES)
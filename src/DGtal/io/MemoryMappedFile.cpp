@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file MemoryMappedFile.cpp
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Implementation of methods defined in MemoryMappedFile.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/io/MemoryMappedFile.h"
+#include "DGtal/base/Exceptions.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+// class MemoryMappedFile
+///////////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::MemoryMappedFile::MemoryMappedFile( const std::string & filename )
+  : myFilename( filename ), myData( NULL ), mySize( 0 )
+{
+#ifdef _WIN32
+  myFileHandle = NULL;
+  myMappingHandle = NULL;
+
+  HANDLE file = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+  if ( file == INVALID_HANDLE_VALUE )
+    {
+      trace.error() << "MemoryMappedFile: can't open " << filename << std::endl;
+      throw IOException();
+    }
+
+  LARGE_INTEGER fileSize;
+  if ( ! GetFileSizeEx( file, &fileSize ) )
+    {
+      CloseHandle( file );
+      trace.error() << "MemoryMappedFile: can't get the size of " << filename << std::endl;
+      throw IOException();
+    }
+  mySize = static_cast<std::size_t>( fileSize.QuadPart );
+  myFileHandle = file;
+
+  if ( mySize == 0 )
+    return;
+
+  HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+  if ( mapping == NULL )
+    {
+      CloseHandle( file );
+      trace.error() << "MemoryMappedFile: can't map " << filename << std::endl;
+      throw IOException();
+    }
+  myMappingHandle = mapping;
+
+  myData = static_cast<const char*>( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+  if ( myData == NULL )
+    {
+      CloseHandle( mapping );
+      CloseHandle( file );
+      trace.error() << "MemoryMappedFile: can't map " << filename << std::endl;
+      throw IOException();
+    }
+#else
+  int fd = open( filename.c_str(), O_RDONLY );
+  if ( fd == -1 )
+    {
+      trace.error() << "MemoryMappedFile: can't open " << filename << std::endl;
+      throw IOException();
+    }
+
+  struct stat fileStat;
+  if ( fstat( fd, &fileStat ) == -1 )
+    {
+      close( fd );
+      trace.error() << "MemoryMappedFile: can't get the size of " << filename << std::endl;
+      throw IOException();
+    }
+  mySize = static_cast<std::size_t>( fileStat.st_size );
+
+  if ( mySize != 0 )
+    {
+      void * mapping = mmap( NULL, mySize, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if ( mapping == MAP_FAILED )
+        {
+          close( fd );
+          trace.error() << "MemoryMappedFile: can't map " << filename << std::endl;
+          throw IOException();
+        }
+      myData = static_cast<const char*>( mapping );
+    }
+
+  // The mapping stays valid once the file descriptor is closed.
+  close( fd );
+#endif
+}
+
+DGtal::MemoryMappedFile::~MemoryMappedFile()
+{
+#ifdef _WIN32
+  if ( myData != NULL )
+    UnmapViewOfFile( myData );
+  if ( myMappingHandle != NULL )
+    CloseHandle( myMappingHandle );
+  if ( myFileHandle != NULL )
+    CloseHandle( myFileHandle );
+#else
+  if ( myData != NULL )
+    munmap( const_cast<char*>( myData ), mySize );
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::MemoryMappedFile::selfDisplay ( std::ostream & out ) const
+{
+  out << "[MemoryMappedFile] " << myFilename << " (" << mySize << " bytes)";
+}
+
+bool
+DGtal::MemoryMappedFile::isValid() const
+{
+  return ( mySize == 0 ) || ( myData != NULL );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation of inline functions and external operators                 //
+
+std::ostream&
+DGtal::operator<< ( std::ostream & out, const MemoryMappedFile & object )
+{
+  object.selfDisplay( out );
+  return out;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
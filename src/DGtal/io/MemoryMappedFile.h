@@ -0,0 +1,167 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MemoryMappedFile.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module MemoryMappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MemoryMappedFile_RECURSES)
+#error Recursive header files inclusion detected in MemoryMappedFile.h
+#else // defined(MemoryMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MemoryMappedFile_RECURSES
+
+#if !defined MemoryMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define MemoryMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MemoryMappedFile
+  /**
+   * Description of class 'MemoryMappedFile' <p>
+   * \brief Aim: maps a whole file in memory, read-only.
+   *
+   * The file is mapped in constant time: its pages are only loaded by
+   * the operating system when they are accessed for the first time, and
+   * they are shared with the file system cache (no copy of the file is
+   * made in memory).
+   *
+   * @see ImageContainerByMemoryMappedFile
+   */
+  class MemoryMappedFile
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps the file filename.
+     *
+     * @param filename the name of the file.
+     * @throw IOException if the file cannot be opened or mapped.
+     */
+    MemoryMappedFile( const std::string & filename );
+
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~MemoryMappedFile();
+
+  private:
+
+    MemoryMappedFile( const MemoryMappedFile & other );
+
+    MemoryMappedFile & operator=( const MemoryMappedFile & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return a pointer to the first byte of the file (NULL for an empty file).
+     */
+    const char * data() const
+    {
+      return myData;
+    }
+
+    /**
+     * @return the size of the file in bytes.
+     */
+    std::size_t size() const
+    {
+      return mySize;
+    }
+
+    /**
+     * @return the name of the mapped file.
+     */
+    const std::string & filename() const
+    {
+      return myFilename;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Name of the file
+    std::string myFilename;
+
+    /// First byte of the mapping
+    const char * myData;
+
+    /// Size of the file in bytes
+    std::size_t mySize;
+
+#ifdef _WIN32
+    /// File handle
+    void * myFileHandle;
+
+    /// File mapping handle
+    void * myMappingHandle;
+#endif
+
+  }; // end of class MemoryMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MemoryMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MemoryMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MemoryMappedFile & object );
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MemoryMappedFile_h
+
+#undef MemoryMappedFile_RECURSES
+#endif // else defined(MemoryMappedFile_RECURSES)
@@ -7,7 +7,9 @@
 ##########################################
 
 set(DGTAL_SRC ${DGTAL_SRC}
-  DGtal/io/Color.cpp)
+  DGtal/io/Color.cpp
+  DGtal/io/MemoryMappedFile.cpp
+  DGtal/io/ChunkedZlib.cpp)
 
 
 set(DGTALIO_SRC ${DGTALIO_SRC}
@@ -48,6 +48,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMappedFile.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -95,6 +96,9 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;
     typedef TFunctor Functor;
+
+    /// Type of the images returned by mapLongvol
+    typedef ImageContainerByMemoryMappedFile<typename TImageContainer::Domain, Value, DGtal::uint64_t, Functor> MappedImageContainer;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, DGtal::uint64_t, Value > )) ;
     BOOST_STATIC_ASSERT(ImageContainer::Domain::dimension == 3);
@@ -113,6 +117,22 @@ namespace DGtal
      */
     static ImageContainer importLongvol(const std::string & filename,
                                         const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps an uncompressed Longvol (Version 2) in memory, without reading it.
+     * The header is parsed and the voxel values are read and converted by
+     * aFunctor when they are accessed.
+     *
+     * @param filename the file name to map.
+     * @param aFunctor the functor used to cast the source
+     * image values into the type of the image container value (by
+     * default set to functors::Cast < TImageContainer::Value > .
+     *
+     * @return an image mapped on the file.
+     * @throw IOException if the file cannot be mapped, or is compressed (Version 3).
+     */
+    static MappedImageContainer mapLongvol(const std::string & filename,
+                                      const Functor & aFunctor =  Functor());
     
     
     
@@ -176,6 +196,18 @@ namespace DGtal
     };
     
     
+    /**
+     * Reads the header of a Longvol file and leaves fin at the first voxel.
+     *
+     * @param fin the opened file.
+     * @param version the Version field of the header (2 or 3).
+     * @param chunkSize the Chunk-Size field of the header, 0 if absent
+     * (see ChunkedZlibWriter).
+     * @return the image domain.
+     * @throw IOException if the header is invalid.
+     */
+    static typename TImageContainer::Domain readHeader( FILE * fin, int & version, int & chunkSize );
+
     //! Returns NULL if this field is not found
     static const char *getHeaderValue( const char *type, const HeaderField * header );
     
@@ -45,6 +45,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMappedFile.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,10 @@ namespace DGtal
    *
    * All these methods return an instance of the template parameter \c TImageContainer. A functor can be specified to convert raw values to image values.
    *
+   * The method \c mapRaw maps the file in memory instead of reading it and returns an
+   * ImageContainerByMemoryMappedFile: the file is opened in constant time and its values
+   * are read and converted only when they are accessed.
+   *
    * Example usage:
    * @code
    * ...
@@ -100,6 +105,10 @@ namespace DGtal
     typedef typename TImageContainer::Domain::Vector Vector;
     typedef TFunctor Functor;
 
+    /// Type of the images returned by mapRaw
+    template <typename Word>
+    using MappedImageContainer = ImageContainerByMemoryMappedFile<typename TImageContainer::Domain, Value, Word, Functor>;
+
     /**
      * Method to import a Raw (any type stored in little-endian format)
      * into an instance of the template parameter ImageContainer.
@@ -166,6 +175,25 @@ namespace DGtal
              const Vector & extent,
              const Functor & aFunctor =  Functor());
 
+    /**
+     * Method to map a Raw (any type stored in little-endian format)
+     * in memory, without reading it. The values are read and converted
+     * by aFunctor when they are accessed.
+     *
+     * @tparam Word read pixel type.
+     * @param filename the file name to map.
+     * @param extent the size of the raw data set.
+     * @param aFunctor the functor used to cast the source image values
+     * into the type of the image container value (by default set to
+     * functors::Cast < TImageContainer::Value > ).
+     * aFunctor must accept Word as input.
+     * @return an image mapped on the file.
+     */
+    template <typename Word>
+    static MappedImageContainer<Word> mapRaw(const std::string & filename,
+             const Vector & extent,
+             const Functor & aFunctor =  Functor());
+
 
   private:
 
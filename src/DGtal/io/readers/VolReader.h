@@ -46,6 +46,7 @@
 #include <cstdio>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/images/ImageContainerByMemoryMappedFile.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -93,6 +94,9 @@ namespace DGtal
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Value Value;
     typedef TFunctor Functor;
+
+    /// Type of the images returned by mapVol
+    typedef ImageContainerByMemoryMappedFile<typename TImageContainer::Domain, Value, unsigned char, Functor> MappedImageContainer;
     
     BOOST_CONCEPT_ASSERT((  concepts::CUnaryFunctor<TFunctor, unsigned char, Value > )) ;    
 
@@ -113,6 +117,22 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
                                     const Functor & aFunctor =  Functor());
+
+    /**
+     * Maps an uncompressed Vol (Version 2) in memory, without reading it.
+     * The header is parsed and the voxel values are read and converted by
+     * aFunctor when they are accessed.
+     *
+     * @param filename the file name to map.
+     * @param aFunctor the functor used to cast the source
+     * image values into the type of the image container value (by
+     * default set to functors::Cast < TImageContainer::Value > .
+     *
+     * @return an image mapped on the file.
+     * @throw IOException if the file cannot be mapped, or is compressed (Version 3).
+     */
+    static MappedImageContainer mapVol(const std::string & filename,
+                                      const Functor & aFunctor =  Functor());
     
   private:
 
@@ -155,6 +175,18 @@ namespace DGtal
     };
 
 
+    /**
+     * Reads the header of a Vol file and leaves fin at the first voxel.
+     *
+     * @param fin the opened file.
+     * @param version the Version field of the header (2 or 3).
+     * @param chunkSize the Chunk-Size field of the header, 0 if absent
+     * (see ChunkedZlibWriter).
+     * @return the image domain.
+     * @throw IOException if the header is invalid.
+     */
+    static typename TImageContainer::Domain readHeader( FILE * fin, int & version, int & chunkSize );
+
     //! Returns NULL if this field is not found
     static const char *getHeaderValue( const char *type, const HeaderField * header );
 
@@ -60,6 +60,10 @@ namespace DGtal
    * A functor can be specified to convert image values to LongVol values
    * (DGtal::uint64_t).
    *
+   * The compressed export cuts the volume into chunks of slices which
+   * are compressed in parallel (see VolSliceWriter to export a volume
+   * slice by slice).
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    *
@@ -93,25 +97,6 @@ namespace DGtal
                               const Functor & aFunctor = Functor());
     
     
-  private: 
-    
-    /** 
-     * Generic write word (binary mode) in little-endian.
-     * 
-     * @param outs output stream.
-     * @param value value to write.
-     * 
-     * @return modified stream.
-     */
-    template <typename Word>
-    static
-    std::ostream& write_word( std::ostream& outs, Word value )
-    {
-      for (unsigned size = sizeof( Word ); size; --size, value >>= 8)
-        outs.put( static_cast <char> (value & 0xFF) );
-      return outs;
-    }
-    
   };
 }//namespace
 
@@ -0,0 +1,268 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolSliceWriter.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module VolSliceWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolSliceWriter_RECURSES)
+#error Recursive header files inclusion detected in VolSliceWriter.h
+#else // defined(VolSliceWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolSliceWriter_RECURSES
+
+#if !defined VolSliceWriter_h
+/** Prevents repeated inclusion of headers. */
+#define VolSliceWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <memory>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/ChunkedZlib.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VolSliceWriter
+  /**
+   * Description of template class 'VolSliceWriter' <p>
+   * \brief Aim: Export a 3D Image in the Vol or Longvol formats slice
+   * by slice, while the slices are produced.
+   *
+   * The slices (planes of constant z coordinate) are given in
+   * increasing z order. In the compressed format (Version 3), the
+   * voxels are compressed by chunks of slicesPerChunk() slices, the
+   * chunks being compressed in parallel while the next slices are
+   * produced (see ChunkedZlibWriter). The header then contains a
+   * "Chunk-Size" field (number of uncompressed bytes per chunk), which
+   * VolReader and LongvolReader use to decompress the chunks in
+   * parallel. The compressed data is still a standard zlib stream.
+   *
+   * Example usage:
+   * @code
+   * VolSliceWriter<Z3i::Domain> writer( "labels.vol", domain );
+   * for ( int z = domain.lowerBound()[2]; z <= domain.upperBound()[2]; ++z )
+   *   {
+   *     computeSlice( image, z );
+   *     writer.writeSlice( image );
+   *   }
+   * writer.close();
+   * @endcode
+   *
+   * @tparam TDomain the type of domain (3D HyperRectDomain).
+   * @tparam TWord the type of the voxels in the file: unsigned char
+   * (Vol format) or DGtal::uint64_t (Longvol format).
+   *
+   * @see VolWriter, LongvolWriter, testCompressedVolWriter.cpp
+   */
+  template <typename TDomain, typename TWord = unsigned char>
+  class VolSliceWriter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef TWord Word;
+
+    BOOST_STATIC_ASSERT( Domain::dimension == 3 );
+    BOOST_STATIC_ASSERT( ( boost::is_same<Word, unsigned char>::value ||
+                           boost::is_same<Word, DGtal::uint64_t>::value ) );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Creates the file and writes its header.
+     *
+     * @param filename name of the output file.
+     * @param aDomain the domain of the exported image.
+     * @param compressed boolean to decide wether the file must be compressed or not.
+     * @param slicesPerChunk the number of slices per compressed chunk,
+     * 0 (default) means about one megabyte per chunk.
+     * @param nbThreads the maximal number of chunks compressed at the
+     * same time, 0 (default) means functions::parallelNbThreads().
+     * @throw IOException if the file cannot be created.
+     */
+    VolSliceWriter( const std::string & filename, const Domain & aDomain,
+                    bool compressed = true,
+                    unsigned int slicesPerChunk = 0,
+                    unsigned int nbThreads = 0 );
+
+    /**
+     * Destructor. Closes the file if close() has not been called,
+     * errors are then ignored.
+     */
+    ~VolSliceWriter();
+
+  private:
+
+    VolSliceWriter( const VolSliceWriter & other );
+
+    VolSliceWriter & operator=( const VolSliceWriter & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes the next slice, read from an image whose domain contains it.
+     *
+     * @param anImage any image containing the next slice.
+     * @param aFunctor the functor used to cast image values to Word.
+     *
+     * @tparam TImage the image type (3D).
+     * @tparam TFunctor the type of functor.
+     * @throw IOException if the slice cannot be written.
+     */
+    template <typename TImage, typename TFunctor = functors::Identity>
+    void writeSlice( const TImage & anImage, const TFunctor & aFunctor = TFunctor() );
+
+    /**
+     * Writes the next slice, given by the sequence of its values (x
+     * first, then y).
+     *
+     * @param first an iterator on the first value of the slice, the
+     * values being convertible to Word.
+     *
+     * @tparam TInputIterator a model of input iterator.
+     * @throw IOException if the slice cannot be written.
+     */
+    template <typename TInputIterator>
+    void writeSliceValues( TInputIterator first );
+
+    /**
+     * Flushes the data and closes the file. Does nothing if the file is
+     * already closed.
+     *
+     * @throw IOException if the file cannot be written or if some
+     * slices are missing.
+     */
+    void close();
+
+    /**
+     * @return the number of slices written so far.
+     */
+    unsigned int nbSlices() const
+    {
+      return myNbSlices;
+    }
+
+    /**
+     * @return the number of slices per compressed chunk.
+     */
+    unsigned int slicesPerChunk() const
+    {
+      return mySlicesPerChunk;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Name of the file
+    std::string myFilename;
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Output file
+    std::ofstream myOut;
+
+    /// Chunked compression of the voxels (compressed format only)
+    std::unique_ptr<ChunkedZlibWriter> myCompressor;
+
+    /// Bytes of the current slice
+    std::string mySlice;
+
+    /// Number of slices written so far
+    unsigned int myNbSlices;
+
+    /// Number of slices per compressed chunk
+    unsigned int mySlicesPerChunk;
+
+    /// 'true' once close() has been called
+    bool myIsClosed;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Appends a word to the current slice, in little-endian.
+     * @param aWord the word.
+     */
+    void putWord( Word aWord );
+
+    /**
+     * Writes the current slice to the file.
+     */
+    void flushSlice();
+
+  }; // end of class VolSliceWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'VolSliceWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'VolSliceWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TWord>
+  std::ostream&
+  operator<< ( std::ostream & out, const VolSliceWriter<TDomain, TWord> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/VolSliceWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolSliceWriter_h
+
+#undef VolSliceWriter_RECURSES
+#endif // else defined(VolSliceWriter_RECURSES)
@@ -61,6 +61,10 @@ namespace DGtal
    * A functor can be specified to convert image values to Vol values
    * (unsigned char).
    *
+   * The compressed export cuts the volume into chunks of slices which
+   * are compressed in parallel (see VolSliceWriter to export a volume
+   * slice by slice).
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    */
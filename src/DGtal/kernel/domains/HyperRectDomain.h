@@ -51,6 +51,7 @@
 #include "DGtal/kernel/domains/HyperRectDomain_Iterator.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/base/CConstBidirectionalRange.h"
+#include "DGtal/base/ParallelFor.h"
 
 namespace DGtal
 {
@@ -602,6 +603,53 @@ namespace DGtal
      */
     const Predicate & predicate() const;
 
+    // ----------------------- Row traversal ----------------------------------
+  public:
+
+    /**
+     * @return the number of rows of the domain, i.e. of lines of
+     * points along the first axis (0 if the domain is empty).
+     */
+    Size nbRows() const;
+
+    /**
+     * @return the number of points of each row.
+     */
+    Size rowLength() const;
+
+    /**
+     * @param aRow the index of a row, in [0,nbRows()).
+     * @return the first point of this row. Rows are numbered in the
+     * order of the domain iterators.
+     */
+    Point rowOrigin( Size aRow ) const;
+
+    /**
+     * Calls @a f( origin, length ) for each row of the domain, @a
+     * origin being the first point of the row and @a length its number
+     * of points. The points of a row are then origin + i.e_0, for i in
+     * [0,length), and can be visited by a tight loop instead of the
+     * domain iterators.
+     *
+     * @code
+     * domain.forEachRow( [&] ( const Point & origin, Size length )
+     *   {
+     *     for ( Size i = 0; i < length; ++i ) ...
+     *   } );
+     * @endcode
+     *
+     * @param f any functor taking a Point and a Size.
+     * @param nbThreads 1 (default) visits the rows sequentially in the
+     * order of the domain iterators, otherwise the rows are visited in
+     * parallel by at most @a nbThreads threads (0 means
+     * functions::parallelNbThreads()), @a f being then called
+     * concurrently.
+     *
+     * @tparam TFunction the type of @a f.
+     */
+    template <typename TFunction>
+    void forEachRow( TFunction f, unsigned int nbThreads = 1 ) const;
+
     // ------------------------- Private Datas --------------------------------
   private:
 
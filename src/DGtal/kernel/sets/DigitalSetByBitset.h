@@ -0,0 +1,469 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitset.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module DigitalSetByBitset.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitset_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitset.h
+#else // defined(DigitalSetByBitset_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitset_RECURSES
+
+#if !defined DigitalSetByBitset_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitset_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <iterator>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitset
+  /**
+    Description of template class 'DigitalSetByBitset' <p> \brief
+    Aim: Realizes the concept CDigitalSet by using a bitset over the
+    points of its domain, linearized with Linearizer (first coordinate
+    first).
+
+    Each point of the domain takes one bit, whatever the number of
+    points in the set: this container is adapted to dense sets (a large
+    part of a bounded domain, e.g. binary volumes), for which it is
+    much smaller and faster than sets of points. Insertion, removal and
+    membership tests are in O(1). Iterating visits the points in the
+    order of the domain, by scanning the non-zero words of the bitset.
+    Union (operator+=), intersection (operator&=) and difference
+    (operator-=) of two sets with the same domain are computed word by
+    word.
+
+    The iterators are constant: they give points by value, and may be
+    used to erase points, as required by CDigitalSet.
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet, DigitalSetSelector, testDigitalSet.cpp
+   */
+  template <typename TDomain>
+  class DigitalSetByBitset
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitset<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    /// Type of the words of the bitset
+    typedef DGtal::uint64_t Word;
+    typedef std::vector<Word> Container;
+    typedef Linearizer<Domain, ColMajorStorage> DomainLinearizer;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain< Space > >::value ));
+
+    /**
+     * Iterator on the points of the set, in the linearized order of
+     * the domain.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       std::forward_iterator_tag, Point >
+    {
+    public:
+      /// Default constructor (singular iterator).
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+
+      /**
+       * Constructor.
+       * @param aSet the set.
+       * @param anIndex the index of a point of the set, or the size of the domain.
+       */
+      ConstIterator( const Self* aSet, std::size_t anIndex )
+        : mySet( aSet ), myIndex( anIndex ) {}
+
+      /// @return the index of the pointed point in the bitset.
+      std::size_t index() const { return myIndex; }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      Point dereference() const
+      {
+        return mySet->pointOf( myIndex );
+      }
+
+      bool equal( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      void increment()
+      {
+        myIndex = mySet->nextIndex( myIndex + 1 );
+      }
+
+      /// The set
+      const Self* mySet;
+      /// Index of the pointed point
+      std::size_t myIndex;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitset();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitset( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitset ( const DigitalSetByBitset & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator= ( const DigitalSetByBitset & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (constant time).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set. Same as insert for this container.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert for this container.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * Give access to the underlying container.
+     * @return a const reference to the words of the bitset.
+     */
+    const Container & container() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator+= ( const Self & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator&= ( const Self & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator-= ( const Self & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// Lower bound of the domain
+    Point myLowerBound;
+
+    /// Extent of the domain
+    Point myExtent;
+
+    /// Number of points of the domain
+    std::size_t myNbBits;
+
+    /// The bitset, one bit per point of the domain
+    Container myWords;
+
+    /// Number of points of the set
+    Size mySize;
+
+    // --------------- CDrawableWithBoard2D realization --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitset();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p a point of the domain.
+     * @return its index in the bitset.
+     */
+    std::size_t indexOf( const Point & p ) const;
+
+    /**
+     * @param i an index in the bitset.
+     * @return the corresponding point of the domain.
+     */
+    Point pointOf( std::size_t i ) const;
+
+    /**
+     * @param i an index in the bitset.
+     * @return the first index not smaller than i of a point of the
+     * set, or myNbBits.
+     */
+    std::size_t nextIndex( std::size_t i ) const;
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' if aSet has the same domain as this set.
+     */
+    bool sameDomain( const Self & aSet ) const;
+
+    /**
+     * Clears the bits after the last point of the domain, and recounts
+     * the points of the set.
+     */
+    void normalize();
+
+  }; // end of class DigitalSetByBitset
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitset'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitset' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitset<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitset.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitset_h
+
+#undef DigitalSetByBitset_RECURSES
+#endif // else defined(DigitalSetByBitset_RECURSES)
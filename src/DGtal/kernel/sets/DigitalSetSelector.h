@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 #include <unordered_set>
@@ -83,6 +84,10 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Sets filling a large part of their domain (WHOLE_DS) with many
+   * belonging tests (HIGH_BEL_DS) are represented by a
+   * DigitalSetByBitset, whose size only depends on the domain.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -0,0 +1,273 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshFaceGrid.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module SurfaceMeshFaceGrid.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshFaceGrid_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshFaceGrid.h
+#else // defined(SurfaceMeshFaceGrid_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshFaceGrid_RECURSES
+
+#if !defined SurfaceMeshFaceGrid_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshFaceGrid_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshFaceGrid
+  /**
+     Description of template class 'SurfaceMeshFaceGrid' <p> \brief
+     Aim: A uniform grid over the faces of a SurfaceMesh, in order to
+     find quickly the vertices, edges and faces of the mesh that
+     intersect a given ball.
+
+     Each face is stored in every grid cell intersected by its
+     bounding box (in compressed row storage), so that a ball query
+     only visits the faces of the grid cells intersected by the
+     bounding box of the ball. The inclusion ratios are then computed
+     by SurfaceMesh::faceInclusionRatio,
+     SurfaceMesh::edgeInclusionRatio and
+     SurfaceMesh::vertexInclusionRatio, as in
+     SurfaceMesh::computeFacesInclusionsInBall and
+     SurfaceMesh::computeCellsInclusionsInBall.
+
+     The grid is built once for a given size of cells, which should be
+     close to the radius of the balls that will be queried. The
+     queries are const and may be run in parallel.
+
+     \code
+     SurfaceMeshFaceGrid< RealPoint, RealVector > grid( smesh, r );
+     for ( Face f = 0; f < smesh.nbFaces(); ++f )
+       {
+         auto wfaces = grid.computeFacesInclusionsInBall( r, smesh.faceCentroid( f ) );
+         ...
+       }
+     \endcode
+
+     @note Contrary to SurfaceMesh::computeFacesInclusionsInBall,
+     which does a breadth-first traversal of the faces from the face
+     containing the center of the ball, the grid returns all the faces
+     with a positive inclusion ratio, even those that are not
+     connected to the center through such faces. Both coincide when
+     the part of the mesh in the ball is connected, e.g. when the
+     radius is small compared to the reach of the surface. The order
+     of the returned faces is also different.
+
+     @tparam TRealPoint an arbitrary model of 3D RealPoint.
+     @tparam TRealVector an arbitrary model of 3D RealVector.
+  */
+  template < typename TRealPoint, typename TRealVector >
+  class SurfaceMeshFaceGrid
+  {
+    // ----------------------- Public types ------------------------------
+  public:
+    typedef TRealPoint                                   RealPoint;
+    typedef TRealVector                                  RealVector;
+    typedef SurfaceMeshFaceGrid< RealPoint, RealVector > Self;
+    typedef DGtal::SurfaceMesh< RealPoint, RealVector >  SurfaceMesh;
+    typedef typename SurfaceMesh::Scalar                 Scalar;
+    typedef typename SurfaceMesh::Size                   Size;
+    typedef typename SurfaceMesh::Index                  Index;
+    typedef typename SurfaceMesh::Vertex                 Vertex;
+    typedef typename SurfaceMesh::Edge                   Edge;
+    typedef typename SurfaceMesh::Face                   Face;
+    typedef typename SurfaceMesh::Vertices               Vertices;
+    typedef typename SurfaceMesh::Faces                  Faces;
+    typedef typename SurfaceMesh::WeightedEdges          WeightedEdges;
+    typedef typename SurfaceMesh::WeightedFaces          WeightedFaces;
+    static const Dimension dimension = RealPoint::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The object is not valid.
+    SurfaceMeshFaceGrid();
+
+    /// Constructor from mesh. The mesh is referenced and must not be
+    /// modified while the grid is used.
+    ///
+    /// @param aMesh the mesh, which should have at least one face.
+    ///
+    /// @param cellSize the size of the grid cells (a positive value,
+    /// typically the radius of the balls), which is enlarged when
+    /// the grid would have too many cells with respect to the
+    /// number of faces.
+    SurfaceMeshFaceGrid( ConstAlias< SurfaceMesh > aMesh, Scalar cellSize );
+
+    /// Builds the grid.
+    ///
+    /// @param aMesh the mesh, which should have at least one face.
+    ///
+    /// @param cellSize the size of the grid cells (a positive value,
+    /// typically the radius of the balls), which is enlarged when
+    /// the grid would have too many cells with respect to the
+    /// number of faces.
+    void init( ConstAlias< SurfaceMesh > aMesh, Scalar cellSize );
+
+    /// @return a pointer to the associated mesh or nullptr if the
+    /// grid is not valid.
+    const SurfaceMesh* meshPtr() const
+    {
+      return myMeshPtr;
+    }
+
+    /// @return the size of the grid cells.
+    Scalar cellSize() const
+    {
+      return myCellSize;
+    }
+
+    /// @return the number of cells of the grid.
+    Size nbCells() const
+    {
+      return myExtent[ 0 ] * myExtent[ 1 ] * myExtent[ 2 ];
+    }
+
+    // ----------------------- Ball queries ------------------------------
+  public:
+
+    /// Calls the function \a visitor once on each face whose bounding
+    /// box intersects the bounding box of the ball of center \a p and
+    /// radius \a r.
+    ///
+    /// @tparam TFaceVisitor the type of a function `void( Face )`.
+    /// @param r the radius of the ball.
+    /// @param p the center of the ball.
+    /// @param visitor the function called on each face.
+    template < typename TFaceVisitor >
+    void visitFacesNearBall( Scalar r, const RealPoint& p,
+                             TFaceVisitor&& visitor ) const;
+
+    /// Given a ball of radius \a r centered on a point \a p, return
+    /// the faces having a non empty intersection with this ball, each
+    /// one weighted by its ratio of inclusion (in the range [0,1]
+    /// where 0 is empty intersection and 1 is completely included).
+    ///
+    /// @param r the radius of the ball.
+    /// @param p the center of the ball.
+    ///
+    /// @return the range of faces having a non empty intersection
+    /// with this ball, with their ratio of inclusion as computed by
+    /// SurfaceMesh::faceInclusionRatio, in increasing order of faces.
+    WeightedFaces
+    computeFacesInclusionsInBall( Scalar r, const RealPoint& p ) const;
+
+    /// Given a ball of radius \a r centered on a point \a p, return
+    /// the vertices/edges/faces having a non empty intersection with
+    /// this ball, each edge/face weighted by its ratio of inclusion
+    /// (in the range [0,1] where 0 is empty intersection and 1 is
+    /// completely included).
+    ///
+    /// @param r the radius of the ball.
+    /// @param p the center of the ball.
+    ///
+    /// @return the range of vertices/edges/faces having a non empty
+    /// intersection with this ball, chosen as in
+    /// SurfaceMesh::computeCellsInclusionsInBall among the faces with
+    /// a positive ratio of inclusion.
+    std::tuple< Vertices, WeightedEdges, WeightedFaces >
+    computeCellsInclusionsInBall( Scalar r, const RealPoint& p ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The mesh, or nullptr if the grid is not valid.
+    const SurfaceMesh* myMeshPtr;
+    /// The size of the grid cells.
+    Scalar myCellSize;
+    /// The lowest point of the grid.
+    RealPoint myLowerBound;
+    /// The number of cells of the grid along each axis.
+    Size myExtent[ 3 ];
+    /// The faces of the cell `c` are `myCellFaces[ myCellStart[ c ] ]`
+    /// to `myCellFaces[ myCellStart[ c+1 ]-1 ]`.
+    std::vector< Index > myCellStart;
+    /// The faces of all the cells, cell after cell.
+    Faces myCellFaces;
+    /// The lowest points of the bounding boxes of the faces.
+    std::vector< RealPoint > myFaceLower;
+    /// The highest points of the bounding boxes of the faces.
+    std::vector< RealPoint > myFaceUpper;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// @param x any coordinate.
+    /// @param k any axis.
+    /// @return the coordinate along axis \a k of the grid cell
+    /// containing \a x, clamped to the grid.
+    Size cellCoordinate( Scalar x, Dimension k ) const;
+
+  }; // end of class SurfaceMeshFaceGrid
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfaceMeshFaceGrid'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfaceMeshFaceGrid' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TRealPoint, typename TRealVector >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const SurfaceMeshFaceGrid<TRealPoint, TRealVector> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "SurfaceMeshFaceGrid.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshFaceGrid_h
+
+#undef SurfaceMeshFaceGrid_RECURSES
+#endif // else defined(SurfaceMeshFaceGrid_RECURSES)
@@ -0,0 +1,283 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module ConnectedComponentLabelling.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+    Description of template class 'ConnectedComponentLabelling' <p>
+    \brief Aim: Computes the connected components of a subset of a
+    HyperRectDomain for a MetricAdjacency (4 and 8 adjacencies in 2D, 6,
+    18 and 26 adjacencies in 3D), as a label image.
+
+    This is the scanline union-find labelling: the points are visited in
+    the order of the domain, and each foreground point is merged with its
+    foreground neighbors already visited. The union-find forest is stored
+    in an array indexed by the points of the domain, each root being the
+    first point of its component. Components are thus labelled 1, 2, ...
+    in the order of their first point, 0 being the background, whatever
+    the number of threads.
+
+    The domain is cut into slabs of consecutive slices along the last
+    axis, which are labelled in parallel. Components crossing slabs are
+    then merged by visiting the first slice of each slab.
+
+    Contrary to Object::writeComponents, neither hash sets nor graph
+    visitors are used, so that this class is adapted to objects with
+    hundreds of millions of points.
+
+    @code
+    typedef ConnectedComponentLabelling<Z3i::Space, 3> CCL; // 26-adjacency
+    CCL ccl;
+    ccl.compute( image, 0 ); // foreground: non-zero values of an image
+    for ( CCL::Label l = 1; l <= ccl.nbComponents(); ++l )
+      trace.info() << l << " " << ccl.sizes()[ l ] << std::endl;
+    @endcode
+
+    @tparam TSpace any digital space.
+    @tparam maxNorm1 the adjacency, as in MetricAdjacency.
+    @tparam TLabel the type of labels, an unsigned integer able to
+    index the points of the domain (compute throws std::overflow_error
+    otherwise).
+
+    @see MetricAdjacency, Object, testConnectedComponentLabelling.cpp
+   */
+  template <typename TSpace, Dimension maxNorm1,
+            typename TLabel = DGtal::uint32_t>
+  class ConnectedComponentLabelling
+  {
+  public:
+    typedef TSpace Space;
+    typedef ConnectedComponentLabelling<TSpace, maxNorm1, TLabel> Self;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Size Size;
+    typedef TLabel Label;
+    /// Type of the label image
+    typedef ImageContainerBySTLVector<Domain, Label> LabelImage;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object is not valid until compute() is called.
+     */
+    ConnectedComponentLabelling();
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponentLabelling() = default;
+
+    /**
+     * Labels the connected components of the points of @a aDomain
+     * satisfying @a aPredicate.
+     *
+     * @param aDomain any domain.
+     * @param aPredicate any point predicate, called concurrently.
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     * @return the number of components.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     */
+    template <typename TPointPredicate>
+    Size compute( const Domain & aDomain, const TPointPredicate & aPredicate,
+                  unsigned int nbThreads = 0 );
+
+    /**
+     * Labels the connected components of the points of the domain of
+     * @a anImage whose value is greater than @a aThreshold.
+     *
+     * @param anImage any image stored in a vector.
+     * @param aThreshold the values of the background are lower or
+     * equal to this value.
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     * @return the number of components.
+     *
+     * @tparam TValue the type of the values of the image.
+     */
+    template <typename TValue>
+    Size compute( const ImageContainerBySTLVector<Domain, TValue> & anImage,
+                  const typename ImageContainerBySTLVector<Domain, TValue>::Value & aThreshold,
+                  unsigned int nbThreads = 0 );
+
+    /**
+     * Labels the connected components of @a aSet in its domain.
+     *
+     * @param aSet any set stored as a bitset.
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     * @return the number of components.
+     */
+    Size compute( const DigitalSetByBitset<Domain> & aSet,
+                  unsigned int nbThreads = 0 );
+
+    /**
+     * @return the number of components found by the last call to compute.
+     */
+    Size nbComponents() const;
+
+    /**
+     * @return the label image: 0 for the background, from 1 to
+     * nbComponents() for the points of the components.
+     */
+    const LabelImage & labels() const;
+
+    /**
+     * @return the number of points of each component, indexed by
+     * label (sizes()[0] is the number of background points).
+     */
+    const std::vector<Size> & sizes() const;
+
+    /**
+     * @param l any label in [1,nbComponents()].
+     * @return the first point (in the order of the domain) of the
+     * component @a l.
+     */
+    Point representative( Label l ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The label image (also used for the foreground before labelling)
+    LabelImage myLabels;
+
+    /// The number of points of each component, indexed by label
+    std::vector<Size> mySizes;
+
+    /// The index in the label image of the first point of each component
+    std::vector<std::size_t> myRepresentatives;
+
+    /// Tells if compute has been called
+    bool myIsValid;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Labels the foreground (non-zero values of myLabels).
+     * @param nbThreads the maximal number of threads, 0 means functions::parallelNbThreads().
+     * @return the number of components.
+     */
+    Size label( unsigned int nbThreads );
+
+    /**
+     * Allocates the label image on @a aDomain.
+     *
+     * @param aDomain any domain.
+     * @throw std::overflow_error if Label cannot index the points of @a aDomain.
+     */
+    void initLabels( const Domain & aDomain );
+
+    /**
+     * @param parent the union-find forest.
+     * @param i any index of a point of the foreground.
+     * @return the root of @a i, halving the path from @a i to its root.
+     */
+    static std::size_t find( std::vector<Label> & parent, std::size_t i );
+
+    /**
+     * Merges the trees of @a i and @a j, the root with the greatest
+     * index being linked to the other one.
+     * @param parent the union-find forest.
+     * @param i any index of a point of the foreground.
+     * @param j any index of a point of the foreground.
+     */
+    static void merge( std::vector<Label> & parent, std::size_t i, std::size_t j );
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, Dimension maxNorm1, typename TLabel>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ConnectedComponentLabelling<TSpace, maxNorm1, TLabel> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
@@ -51,6 +51,7 @@
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/ContainerTraits.h"
 #include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/base/FlatMap.h"
 #include "DGtal/topology/CCellularGridSpaceND.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -79,6 +80,83 @@ namespace DGtal
     uint32_t data;
   };
 
+  namespace detail
+  {
+    /**
+     * Insertion and removal of batches of cells in a cell container
+     * of CubicalComplex. In the general case, the cells are inserted
+     * or erased one at a time.
+     *
+     * @tparam TCellContainer any model of associative container, mapping
+     * a cell to a data.
+     */
+    template <typename TCellContainer>
+    struct CellContainerBatch
+    {
+      /// Inserts the pairs (cell, data) of [first,last) whose cell is not in \a C.
+      template <typename InputIterator>
+      static void insert( TCellContainer& C, InputIterator first, InputIterator last )
+      {
+        for ( ; first != last; ++first ) C.insert( *first );
+      }
+      /// Inserts the pairs (cell, data) of [first,last), replacing the data of the cells of \a C.
+      template <typename InputIterator>
+      static void assign( TCellContainer& C, InputIterator first, InputIterator last )
+      {
+        for ( ; first != last; ++first ) C[ first->first ] = first->second;
+      }
+      /// Erases the pairs (cell, data) of \a C satisfying \a pred.
+      template <typename Predicate>
+      static void eraseIf( TCellContainer& C, Predicate pred )
+      {
+        for ( typename TCellContainer::iterator it = C.begin(); it != C.end(); )
+          if ( pred( *it ) ) it = C.erase( it );
+          else ++it;
+      }
+      /// Erases the pairs (cell, data) of \a C pointed by the distinct iterators of [first,last).
+      template <typename IteratorIterator>
+      static void erase( TCellContainer& C, IteratorIterator first, IteratorIterator last )
+      {
+        for ( ; first != last; ++first ) C.erase( *first );
+      }
+    };
+
+    /**
+     * Specialization for FlatMap: batches of cells are sorted and
+     * merged in one pass, and erased in one pass.
+     */
+    template <typename TKey, typename TData, typename TCompare>
+    struct CellContainerBatch< FlatMap< TKey, TData, TCompare > >
+    {
+      typedef FlatMap< TKey, TData, TCompare > CellContainer;
+      template <typename InputIterator>
+      static void insert( CellContainer& C, InputIterator first, InputIterator last )
+      {
+        C.insert( first, last );
+      }
+      template <typename InputIterator>
+      static void assign( CellContainer& C, InputIterator first, InputIterator last )
+      {
+        C.insert_or_assign( first, last );
+      }
+      template <typename Predicate>
+      static void eraseIf( CellContainer& C, Predicate pred )
+      {
+        C.erase_if( pred );
+      }
+      template <typename IteratorIterator>
+      static void erase( CellContainer& C, IteratorIterator first, IteratorIterator last )
+      {
+        std::vector<bool> erased( C.size(), false );
+        for ( ; first != last; ++first ) erased[ *first - C.begin() ] = true;
+        // erase_if visits the elements in order.
+        std::size_t i = 0;
+        C.erase_if( [&erased, &i] ( const typename CellContainer::value_type& )
+                    { return erased[ i++ ]; } );
+      }
+    };
+  } // namespace detail
+
   // Forward definitions.
   template < typename TKSpace, typename TCellContainer >
   class CubicalComplex;
@@ -169,6 +247,15 @@ namespace DGtal
   * (strangely) not models of boost::AssociativeContainer, hence we
   * cannot check concepts here.
   *
+  * @note For big complexes, a FlatMap (a vector of pairs (cell, data)
+  * sorted by cell) is several times smaller than a std::map or a
+  * std::unordered_map. Set operations are then linear merges, while
+  * construct, close, open, closure, star, insertCells, boundary and
+  * getInteriorAndBoundary process the cells of each dimension by
+  * batches. Inserting or erasing single cells is however in O(n), so
+  * that it is not adapted to algorithms erasing cells one by one
+  * (e.g. thinning). Note also that iterators on cells are then
+  * invalidated by any insertion or removal.
   */
   template < typename TKSpace,
              typename TCellContainer = typename TKSpace::template CellMap< CubicalCellData >::Type >
@@ -1304,6 +1391,20 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /// Type for a batch of pairs (cell, data) to insert.
+    typedef std::vector< std::pair< Cell, Data > > CellDataBatch;
+
+    /**
+    * Inserts a batch of pairs (cell, data) of dimension \a d in one
+    * operation of the cell container.
+    *
+    * @param d the dimension of the cells of \a cells.
+    * @param cells a batch of pairs (cell, data), possibly with repeated cells.
+    * @param assign when 'true', the data of the batch replace the data
+    * of the cells already in the complex (as insertCell), otherwise
+    * they are kept (as insert).
+    */
+    void insertCellBatch( Dimension d, const CellDataBatch& cells, bool assign );
 
   private:
 
@@ -211,6 +211,12 @@ namespace DGtal
        @param closed when 'true', the surface is known to be closed,
        hence faster extraction can be performed, default is 'false'.
 
+       @param bitmaps when 'true', the surface is extracted with
+       Surfaces::trackBoundaryWithBitmaps (dense bitmaps over the
+       bounds of \a aKSpace, parallel traversal), which is faster when
+       the space fits the shape, default is 'false'. The point
+       predicate must then be safe to call concurrently.
+
        NB: O(N) computational complexity operation, where N is the
        number of surfels of the surface. This is due to the fact that,
        at construction, the surface is extracted and stored.
@@ -221,7 +227,8 @@ namespace DGtal
                             ConstAlias<PointPredicate> aPP,
                             const Adjacency & adj,
                             const Surfel & s,
-                            bool closed = false );
+                            bool closed = false,
+                            bool bitmaps = false );
 
     /// accessor to surfel adjacency.
     const Adjacency & surfelAdjacency() const;
@@ -309,9 +316,11 @@ namespace DGtal
        @param closed when 'true', the surface is known to be closed,
        hence faster extraction can be performed.
 
+       @param bitmaps when 'true', uses Surfaces::trackBoundaryWithBitmaps.
     */
     void computeSurfels( const Surfel & p,
-                         bool closed );
+                         bool closed,
+                         bool bitmaps = false );
 
 
   private:
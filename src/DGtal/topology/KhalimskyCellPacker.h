@@ -0,0 +1,363 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellPacker.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module KhalimskyCellPacker.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellPacker_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellPacker.h
+#else // defined(KhalimskyCellPacker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellPacker_RECURSES
+
+#if !defined KhalimskyCellPacker_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellPacker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacker
+  /**
+     Description of template class 'KhalimskyCellPacker' <p> \brief
+     Aim: Encodes the cells of a bounded Khalimsky space into single
+     64 bits words, and computes their incident and adjacent cells
+     directly on these words.
+
+     The bit 0 of a packed cell is its sign (1 for positive, always 0
+     for unsigned cells). Then, for each axis k, a field of the word
+     stores the Khalimsky coordinate along k minus twice the lower
+     bound of the space, with just enough bits for the cells of the
+     space. Hence the bit of lowest weight of a field is 1 iff the
+     cell is open along this axis, an incidence adds or subtracts one
+     unit in a field, an adjacency two units, and the sign of an
+     incidence is a parity of some open bits (popcount).
+
+     A packed cell takes 8 bytes instead of the dim integers (plus the
+     sign) of a KhalimskyCell or a SignedKhalimskyCell, and is hashed
+     with a single mixing of the word (see hash()). It is meant to be
+     stored in compact containers, like PackedCellSet.
+
+     The space must be non periodic and its cells must fit in 63 bits
+     (e.g. almost 2^19 spels per axis in 3D), see canPack(). Packed
+     operations check neither the bounds of the space nor the
+     dimension of the cells, like the operations of KhalimskyPreSpaceND.
+
+     @tparam TKSpace a model of CCellularGridSpaceND whose cells are
+     given by Khalimsky coordinates, like KhalimskySpaceND.
+
+     @see PackedCellSet, KhalimskyCellHashFunctions.h
+  */
+  template <typename TKSpace>
+  class KhalimskyCellPacker
+  {
+  public:
+    typedef KhalimskyCellPacker<TKSpace> Self;
+    typedef TKSpace                      KSpace;
+    typedef typename KSpace::Integer     Integer;
+    typedef typename KSpace::Point       Point;
+    typedef typename KSpace::Cell        Cell;
+    typedef typename KSpace::SCell       SCell;
+    /// The type of packed (signed or unsigned) cells.
+    typedef std::uint64_t                PackedCell;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The object is invalid.
+    KhalimskyCellPacker();
+
+    /**
+     * Constructor.
+     * @param aKSpace a non periodic space such that canPack( aKSpace ).
+     */
+    explicit KhalimskyCellPacker( ConstAlias<KSpace> aKSpace );
+
+    /**
+     * @param aKSpace any space.
+     * @return 'true' iff the cells of \a aKSpace can be packed, i.e.
+     * the space is not periodic and its cells fit in 63 bits.
+     */
+    static bool canPack( const KSpace & aKSpace );
+
+    /// @return the associated space.
+    const KSpace & space() const;
+
+    /// @return the number of bits used by packed cells (sign included).
+    unsigned int nbBits() const;
+
+    // ----------------------- Packing ----------------------------------------
+  public:
+
+    /**
+     * @param c any cell of the space.
+     * @return the packed cell of \a c.
+     */
+    PackedCell uPack( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return the packed signed cell of \a c.
+     */
+    PackedCell sPack( const SCell & c ) const;
+
+    /**
+     * @param p any packed cell.
+     * @return the corresponding cell of the space.
+     */
+    Cell uUnpack( PackedCell p ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @return the corresponding signed cell of the space.
+     */
+    SCell sUnpack( PackedCell p ) const;
+
+    /// Overload of uPack for generic code.
+    PackedCell pack( const Cell & c ) const;
+    /// Overload of sPack for generic code.
+    PackedCell pack( const SCell & c ) const;
+
+    /**
+     * Unpacks a cell of the given type (for generic code).
+     * @tparam TCell either Cell or SCell.
+     * @param p any packed cell.
+     * @return the cell of type TCell.
+     */
+    template <typename TCell>
+    TCell unpack( PackedCell p ) const;
+
+    /**
+     * A hash function of packed cells (a bit mixing of the word).
+     * @param p any packed cell.
+     * @return a hash value of \a p.
+     */
+    static std::size_t hash( PackedCell p );
+
+    // ----------------------- Read accessors ---------------------------------
+  public:
+
+    /**
+     * @param p any packed cell.
+     * @param k any axis.
+     * @return the Khalimsky coordinate of \a p along \a k.
+     */
+    Integer uKCoord( PackedCell p, Dimension k ) const;
+
+    /**
+     * @param p any packed cell.
+     * @param k any axis.
+     * @return 'true' iff \a p is open along \a k.
+     */
+    bool uIsOpen( PackedCell p, Dimension k ) const;
+
+    /**
+     * @param p any packed cell.
+     * @return the dimension of \a p.
+     */
+    Dimension uDim( PackedCell p ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @return the sign of \a p.
+     */
+    bool sSign( PackedCell p ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @return the unsigned packed cell of \a p.
+     */
+    PackedCell unsigns( PackedCell p ) const;
+
+    /**
+     * @param p any packed cell.
+     * @param sign a sign.
+     * @return the signed packed cell of \a p with sign \a sign.
+     */
+    PackedCell signs( PackedCell p, bool sign ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @return the cell \a p with the opposite sign.
+     */
+    PackedCell sOpp( PackedCell p ) const;
+
+    /**
+     * @param p any packed surfel.
+     * @return the axis orthogonal to \a p.
+     */
+    Dimension sOrthDir( PackedCell p ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any axis.
+     * @return the direct orientation of \a p along \a k (see
+     * KhalimskyPreSpaceND::sDirect).
+     */
+    bool sDirect( PackedCell p, Dimension k ) const;
+
+    // ----------------------- Incidence, adjacency ---------------------------
+  public:
+
+    /**
+     * @param p any packed cell.
+     * @param k any axis.
+     * @param up if 'true' the incident cell along +k, otherwise along -k.
+     * @return the incident cell of \a p along \a k.
+     */
+    PackedCell uIncident( PackedCell p, Dimension k, bool up ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any axis.
+     * @param up if 'true' the incident cell along +k, otherwise along -k.
+     * @return the signed incident cell of \a p along \a k (see
+     * KhalimskyPreSpaceND::sIncident).
+     */
+    PackedCell sIncident( PackedCell p, Dimension k, bool up ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any axis.
+     * @return the direct incident cell of \a p along \a k.
+     */
+    PackedCell sDirectIncident( PackedCell p, Dimension k ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any axis.
+     * @return the indirect incident cell of \a p along \a k.
+     */
+    PackedCell sIndirectIncident( PackedCell p, Dimension k ) const;
+
+    /**
+     * @param p any packed cell.
+     * @param k any axis.
+     * @param up if 'true' the adjacent cell along +k, otherwise along -k.
+     * @return the adjacent cell of \a p along \a k.
+     */
+    PackedCell uAdjacent( PackedCell p, Dimension k, bool up ) const;
+
+    /**
+     * @param p any packed signed cell.
+     * @param k any axis.
+     * @param up if 'true' the adjacent cell along +k, otherwise along -k.
+     * @return the adjacent cell of \a p along \a k, with the same sign.
+     */
+    PackedCell sAdjacent( PackedCell p, Dimension k, bool up ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The associated space.
+    const KSpace* mySpace;
+    /// Twice the lower bound of the space.
+    Point myOrigin;
+    /// The position of the field of each axis.
+    unsigned int myShifts[ dimension ];
+    /// The mask of the field of each axis (not shifted).
+    PackedCell myMasks[ dimension ];
+    /// For each axis k, the open bits of the axes 0 to k.
+    PackedCell myParityMasks[ dimension ];
+    /// The number of bits used by packed cells.
+    unsigned int myNbBits;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param c any pre-cell (or cell) of the space.
+     * @return the coordinate fields of \a c.
+     */
+    template <typename TPreCell>
+    PackedCell packCoordinates( const TPreCell & c ) const;
+
+    /**
+     * @param p any packed cell.
+     * @return the Khalimsky coordinates of \a p.
+     */
+    Point kCoords( PackedCell p ) const;
+
+    /**
+     * @param p any packed cell.
+     * @param k any axis.
+     * @return the parity of the open axes 0 to k of \a p.
+     */
+    bool parity( PackedCell p, Dimension k ) const;
+
+  }; // end of class KhalimskyCellPacker
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellPacker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellPacker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellPacker<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellPacker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellPacker_h
+
+#undef KhalimskyCellPacker_RECURSES
+#endif // else defined(KhalimskyCellPacker_RECURSES)
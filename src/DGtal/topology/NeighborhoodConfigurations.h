@@ -44,6 +44,7 @@
 #include <unordered_map>
 #include "boost/dynamic_bitset.hpp"
 #include <DGtal/base/CountedPtr.h>
+#include <DGtal/kernel/sets/DigitalSetByBitset.h>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
 
 namespace DGtal {
@@ -114,6 +115,28 @@ namespace DGtal {
   std::unordered_map<TPoint, NeighborhoodConfiguration > >
   mapZeroPointNeighborhoodToConfigurationMask();
 
+  /**
+   * Get the occupancy configuration of the neighborhood of a point in
+   * a set stored as a bitset, with the bit masks of
+   * mapZeroPointNeighborhoodToConfigurationMask. The three bits of each
+   * row of the neighborhood (along the first axis) are read at once in
+   * the words of the bitset, so that no point is looked up.
+   *
+   * @note the points outside the domain of the set are not in the set.
+   *
+   * @tparam TDomain a HyperRectDomain of dimension 2 or 3.
+   * @param aSet any set stored as a bitset.
+   * @param center any point of the domain of @a aSet.
+   *
+   * @return bit configuration of neighborhood
+   * @see Object::getNeighborhoodConfigurationOccupancy
+   */
+  template<typename TDomain>
+  inline
+  NeighborhoodConfiguration
+  getNeighborhoodConfigurationOccupancy( const DigitalSetByBitset<TDomain> & aSet,
+                                         const typename TDomain::Point & center );
+
   } // namespace functions
 } // namespace DGtal
 
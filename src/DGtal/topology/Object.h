@@ -53,6 +53,7 @@
 #include "DGtal/base/Clone.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
@@ -283,6 +284,9 @@ namespace DGtal
 
     /**
      * Get the occupancy configuration of the neighborhood of a point. The neighborhood only depends on the dimension, not the topology of the object (3x3 cube for 3D point, 2x2 square for 2D).
+     * If the point set is a DigitalSetByBitset, the configuration is
+     * read in the words of the bitset (see
+     * functions::getNeighborhoodConfigurationOccupancy).
      * @param center point of the neighborhood. It doesn't matter if center belongs or not to \b input_object.
      *
      * @param mapZeroNeighborhoodToMask maping each point of the neighborhood of point Zero to a NeighborhoodConfiguration.
@@ -605,6 +609,27 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool isSimple( const Point & v ) const;
 
+    /**
+     * Tells for each point of the range [ @a itb, @a ite ) if it is
+     * simple (see isSimple above), writing the results in @a ito.
+     *
+     * When a table is set (see setTable), the points are tested in
+     * parallel by at most @a nbThreads threads, otherwise they are
+     * tested one after the other.
+     *
+     * @param itb begin iterator on points.
+     * @param ite end iterator on points.
+     * @param ito output iterator on bool.
+     * @param nbThreads the maximal number of threads, 1 (default)
+     * tests the points sequentially, 0 means functions::parallelNbThreads().
+     *
+     * @tparam TPointIterator a model of forward iterator on points.
+     * @tparam TOutputIterator a model of output iterator on bool.
+     */
+    template <typename TPointIterator, typename TOutputIterator>
+    void isSimple( TPointIterator itb, TPointIterator ite, TOutputIterator ito,
+                   unsigned int nbThreads = 1 ) const;
+
     /**
      * Use pre-calculated look-up-table to check if point is simple.
      * @note this method is used by isSimple if the object have
@@ -0,0 +1,328 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedCellSet.h
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Header file for module PackedCellSet.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedCellSet_RECURSES)
+#error Recursive header files inclusion detected in PackedCellSet.h
+#else // defined(PackedCellSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedCellSet_RECURSES
+
+#if !defined PackedCellSet_h
+/** Prevents repeated inclusion of headers. */
+#define PackedCellSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedCellSet
+  /**
+     Description of template class 'PackedCellSet' <p> \brief Aim: A
+     set of cells (or of signed cells) of a bounded Khalimsky space,
+     stored as packed 64 bits words (see KhalimskyCellPacker) in an
+     open addressing hash table.
+
+     Each cell takes 8 bytes in a table kept at most half full, instead
+     of a node of a std::set or std::unordered_set holding a full cell.
+     Insertion, lookup and erasure are O(1) on average. Iterators
+     visit the cells in an unspecified order and give them by value
+     (they are unpacked on the fly), hence reference is the cell type
+     itself. As for std::unordered_set, insertions invalidate
+     iterators.
+
+     It may be used instead of KSpace::SurfelSet, e.g. as the surfel
+     set of SetOfSurfels (hence of DigitalSurface, IndexedDigitalSurface
+     and the Shortcuts surfaces), or filled by
+     Surfaces::sMakeBoundary. Since it must know the space, a default
+     constructed set is not usable: it must be constructed (or
+     assigned) from a space.
+
+     @tparam TKSpace a model of CCellularGridSpaceND with Khalimsky
+     coordinates, non periodic (see KhalimskyCellPacker::canPack).
+     @tparam TCell either TKSpace::SCell or TKSpace::Cell.
+
+     @see KhalimskyCellPacker
+  */
+  template < typename TKSpace,
+             typename TCell = typename TKSpace::SCell >
+  class PackedCellSet
+  {
+  public:
+    typedef PackedCellSet<TKSpace, TCell>         Self;
+    typedef TKSpace                               KSpace;
+    typedef TCell                                 Cell;
+    typedef KhalimskyCellPacker<KSpace>           Packer;
+    typedef typename Packer::PackedCell           PackedCell;
+    typedef TCell                                 key_type;
+    typedef TCell                                 value_type;
+    typedef std::size_t                           size_type;
+    typedef std::ptrdiff_t                        difference_type;
+
+    /// Forward iterator on the cells, unpacked on the fly.
+    class const_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef TCell                     value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef TCell                     reference;
+      typedef const TCell*              pointer;
+
+      const_iterator() : mySet( 0 ), myIdx( 0 ) {}
+      const_iterator( const Self* aSet, size_type idx )
+        : mySet( aSet ), myIdx( idx ) { skipEmpty(); }
+
+      reference operator*() const
+      { return mySet->myPacker.template unpack<TCell>( mySet->mySlots[ myIdx ] ); }
+      const_iterator & operator++()
+      { ++myIdx; skipEmpty(); return *this; }
+      const_iterator operator++( int )
+      { const_iterator tmp( *this ); ++( *this ); return tmp; }
+      bool operator==( const const_iterator & other ) const
+      { return myIdx == other.myIdx; }
+      bool operator!=( const const_iterator & other ) const
+      { return myIdx != other.myIdx; }
+      /// @return the packed cell pointed by the iterator.
+      PackedCell packed() const
+      { return mySet->mySlots[ myIdx ]; }
+
+    private:
+      friend class PackedCellSet;
+      void skipEmpty()
+      {
+        while ( myIdx < mySet->mySlots.size()
+                && mySet->mySlots[ myIdx ] == EMPTY ) ++myIdx;
+      }
+      const Self* mySet;
+      size_type myIdx;
+    };
+    typedef const_iterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The set is empty and not usable until
+    /// assigned from a set built on a space.
+    PackedCellSet();
+
+    /**
+     * Constructor. The set is empty.
+     * @param aKSpace a space such that KhalimskyCellPacker<KSpace>::canPack( aKSpace ).
+     */
+    explicit PackedCellSet( ConstAlias<KSpace> aKSpace );
+
+    /**
+     * Constructor from a range of cells.
+     * @tparam InputIterator a model of input iterator on cells.
+     * @param aKSpace a space such that KhalimskyCellPacker<KSpace>::canPack( aKSpace ).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template <typename InputIterator>
+    PackedCellSet( ConstAlias<KSpace> aKSpace,
+                   InputIterator first, InputIterator last );
+
+    /// @return the packer of the cells.
+    const Packer & packer() const;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return an iterator on the first cell.
+    const_iterator begin() const;
+    /// @return an iterator after the last cell.
+    const_iterator end() const;
+    /// @return 'true' iff the set has no cell.
+    bool empty() const;
+    /// @return the number of cells.
+    size_type size() const;
+
+    /**
+     * Allocates the table for \a n cells.
+     * @param n a number of cells.
+     */
+    void reserve( size_type n );
+
+    /// Removes all the cells.
+    void clear();
+
+    /**
+     * Swaps the content with another set.
+     * @param other any set.
+     */
+    void swap( Self & other );
+
+    /**
+     * Inserts a cell.
+     * @param c any cell of the space.
+     * @return an iterator on the cell and 'true' if it was inserted.
+     */
+    std::pair<const_iterator, bool> insert( const Cell & c );
+
+    /**
+     * Inserts a cell (the hint is ignored).
+     * @param hint ignored.
+     * @param c any cell of the space.
+     * @return an iterator on the cell.
+     */
+    const_iterator insert( const_iterator hint, const Cell & c );
+
+    /**
+     * Inserts a range of cells.
+     * @tparam InputIterator a model of input iterator on cells.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Inserts a packed cell.
+     * @param p any packed cell of the packer.
+     * @return 'true' if it was inserted.
+     */
+    bool insertPacked( PackedCell p );
+
+    /**
+     * @param c any cell.
+     * @return an iterator on \a c, or end().
+     */
+    const_iterator find( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return 1 if \a c belongs to the set, 0 otherwise.
+     */
+    size_type count( const Cell & c ) const;
+
+    /**
+     * @param p any packed cell.
+     * @return 'true' if \a p belongs to the set.
+     */
+    bool containsPacked( PackedCell p ) const;
+
+    /**
+     * Removes a cell.
+     * @param c any cell.
+     * @return 1 if \a c was removed, 0 otherwise.
+     */
+    size_type erase( const Cell & c );
+
+    /**
+     * @param other any set.
+     * @return 'true' iff both sets have the same cells.
+     */
+    bool operator==( const Self & other ) const;
+
+    /**
+     * @param other any set.
+     * @return 'true' iff the sets have not the same cells.
+     */
+    bool operator!=( const Self & other ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The value of empty slots (not a packed cell, whose bit 63 is 0).
+    static constexpr PackedCell EMPTY = ~PackedCell( 0 );
+    /// Packs and unpacks cells.
+    Packer myPacker;
+    /// The hash table (its size is 0 or a power of 2).
+    std::vector<PackedCell> mySlots;
+    /// The number of cells.
+    size_type mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any packed cell.
+     * @return the slot of \a p if it is in the set, or the empty slot
+     * where it would be inserted.
+     */
+    size_type slot( PackedCell p ) const;
+
+    /**
+     * Changes the size of the table and reinserts all the cells.
+     * @param nb_slots the new size, a power of 2.
+     */
+    void rehash( size_type nb_slots );
+
+  }; // end of class PackedCellSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedCellSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedCellSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TCell>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedCellSet<TKSpace, TCell> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedCellSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedCellSet_h
+
+#undef PackedCellSet_RECURSES
+#endif // else defined(PackedCellSet_RECURSES)
@@ -42,7 +42,11 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
 #include "DGtal/topology/VoxelComplex.h"
 //////////////////////////////////////////////////////////////////////////////
 namespace DGtal
@@ -81,6 +85,54 @@ namespace DGtal
        uint32_t persistence,
        bool verbose = false
     );
+
+    /**
+     * Thinning by independent subfields. The voxels are partitioned
+     * into the 2^3 subfields of the checkerboard, given by the parity
+     * of their coordinates: two voxels of the same subfield are never
+     * 26-adjacent, so that the simplicity of the voxels of a subfield
+     * does not depend on the removal of the others. Each generation
+     * visits the subfields in turn, tests the voxels of the current
+     * subfield in parallel and removes all the simple ones at once.
+     * The voxels satisfying Skel at the end of a generation are
+     * preserved in the following ones, as in asymetricThinningScheme.
+     * The thinning stops when a generation removes no voxel. A voxel
+     * is tested again only if one of its neighbors has been removed.
+     *
+     * The result does not depend on the number of threads. It is fast
+     * when a simplicity table is loaded in vc (see
+     * VoxelComplex::setSimplicityTable), which is then copied in the
+     * result.
+     *
+     * @note Only the voxels of the complex are considered during the
+     * thinning: Skel and VoxelComplex::isSimple must only depend on
+     * the voxels of the 26-neighborhood of the tested voxel (as all
+     * the Skel functions below), and Skel must be callable
+     * concurrently.
+     *
+     * @tparam TComplex VoxelComplex
+     * @param vc input voxel complex.
+     * @param Skel voxels to preserve, see skelUltimate, skelEnd...
+     * @param nbThreads the maximal number of threads, 0 (default)
+     * means functions::parallelNbThreads().
+     * @param verbose trace the number of voxels at each generation.
+     *
+     * @return the closed voxel complex of the remaining voxels.
+     *
+     * @see asymetricThinningScheme
+     */
+    template < typename TComplex >
+    TComplex
+    subfieldThinningScheme(
+       const TComplex & vc ,
+       std::function<
+       bool(
+         const TComplex & ,
+         const typename TComplex::Cell & )
+       > Skel,
+       unsigned int nbThreads = 0,
+       bool verbose = false
+    );
 //////////////////////////////////////////////////////////////////////////////
 // Select Functions
     /**
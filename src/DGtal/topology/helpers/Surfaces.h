@@ -40,9 +40,13 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
 
@@ -54,6 +58,121 @@
 
 namespace DGtal
 {
+  namespace detail
+  {
+    /**
+       Dense bitmaps used by Surfaces::trackBoundaryWithBitmaps. They
+       store the visited surfels of a Khalimsky space, indexed by their
+       Khalimsky coordinates, and cache the evaluations of a point
+       predicate on the spels of the space (and on the ones just
+       outside its bounds). Both may be updated concurrently.
+
+       @tparam TKSpace the type of cellular grid space.
+       @tparam TPointPredicate a model of concepts::CPointPredicate.
+    */
+    template <typename TKSpace, typename TPointPredicate>
+    class BoundaryTrackingBitmaps
+    {
+    public:
+      typedef TKSpace                     KSpace;
+      typedef TPointPredicate             PointPredicate;
+      typedef typename KSpace::Point      Point;
+      typedef typename KSpace::SCell      SCell;
+      typedef std::atomic< std::uint64_t > Word;
+
+      /// A point predicate reading (and filling) the cache of some bitmaps.
+      struct CachedPredicate
+      {
+        typedef typename KSpace::Point Point;
+        const BoundaryTrackingBitmaps* myBitmaps;
+        bool operator()( const Point & p ) const
+        { return myBitmaps->eval( p ); }
+      };
+
+      /**
+         Constructor. The bitmaps are empty.
+         @param K the space, whose bounds define the size of the bitmaps.
+         @param pp the point predicate to cache.
+      */
+      BoundaryTrackingBitmaps( const KSpace & K, const PointPredicate & pp )
+        : myK( &K ), myPP( &pp ),
+          myLow( K.lowerBound() - Point::diagonal( 1 ) ),
+          myUp( K.upperBound() + Point::diagonal( 1 ) )
+      {
+        std::size_t nbSpels = 1, nbSurfelPoints = 1;
+        for ( Dimension k = 0; k < KSpace::dimension; ++k )
+          {
+            mySpelStrides[ k ]   = nbSpels;
+            mySurfelStrides[ k ] = nbSurfelPoints;
+            nbSpels        *= static_cast<std::size_t>( myUp[ k ] - myLow[ k ] + 1 );
+            nbSurfelPoints *= static_cast<std::size_t>( myUp[ k ] - myLow[ k ] );
+          }
+        // 2 bits per spel (known, value), 1 bit per surfel.
+        mySpels   = std::vector< Word >( ( 2 * nbSpels + 63 ) / 64 );
+        mySurfels = std::vector< Word >
+          ( ( KSpace::dimension * nbSurfelPoints + 63 ) / 64 );
+      }
+
+      /// @return a point predicate reading the cache of these bitmaps.
+      CachedPredicate predicate() const
+      { return CachedPredicate{ this }; }
+
+      /**
+         @param p any point.
+         @return the value of the predicate at @a p, computed only
+         once for the points of the bitmap.
+      */
+      bool eval( const Point & p ) const
+      {
+        std::size_t idx = 0;
+        for ( Dimension k = 0; k < KSpace::dimension; ++k )
+          {
+            if ( p[ k ] < myLow[ k ] || myUp[ k ] < p[ k ] ) return (*myPP)( p );
+            idx += static_cast<std::size_t>( p[ k ] - myLow[ k ] ) * mySpelStrides[ k ];
+          }
+        Word & w = mySpels[ ( 2 * idx ) / 64 ];
+        const unsigned int shift = ( 2 * idx ) % 64;
+        const std::uint64_t bits = w.load( std::memory_order_relaxed ) >> shift;
+        if ( bits & 1 ) return ( bits & 2 ) != 0;
+        const bool value = (*myPP)( p );
+        w.fetch_or( std::uint64_t( value ? 3 : 1 ) << shift,
+                    std::memory_order_relaxed );
+        return value;
+      }
+
+      /**
+         Marks a surfel as visited.
+         @param s any surfel of the space.
+         @return 'true' if @a s was not visited before.
+      */
+      bool visit( const SCell & s )
+      {
+        const Point & x = myK->sKCoords( s );
+        const Dimension orth = myK->sOrthDir( s );
+        std::size_t idx = 0;
+        for ( Dimension k = 0; k < KSpace::dimension; ++k )
+          {
+            // x[ k ] is even along the orthogonal direction, odd otherwise.
+            const typename KSpace::Integer q = ( k == orth ) ? x[ k ] / 2 : ( x[ k ] - 1 ) / 2;
+            idx += static_cast<std::size_t>( q - myLow[ k ] - 1 ) * mySurfelStrides[ k ];
+          }
+        idx = KSpace::dimension * idx + orth;
+        const std::uint64_t mask = std::uint64_t( 1 ) << ( idx % 64 );
+        return ( mySurfels[ idx / 64 ].fetch_or( mask, std::memory_order_relaxed )
+                 & mask ) == 0;
+      }
+
+    private:
+      const KSpace* myK;
+      const PointPredicate* myPP;
+      /// Bounds of the cached spels (the bounds of the space, enlarged by 1).
+      Point myLow, myUp;
+      std::size_t mySpelStrides[ KSpace::dimension ];
+      std::size_t mySurfelStrides[ KSpace::dimension ];
+      mutable std::vector< Word > mySpels;
+      std::vector< Word > mySurfels;
+    };
+  } // namespace detail
 
   /////////////////////////////////////////////////////////////////////////////
   // template class Surfaces
@@ -231,6 +350,54 @@ namespace DGtal
             const SCell & start_surfel );
 
 
+    /**
+       Function that extracts the boundary of a nD digital shape
+       (specified by a predicate on point), closed or open, in a nD
+       KSpace, like trackBoundary (or trackClosedBoundary when @a
+       closed is 'true'), but with dense bitmaps instead of a set of
+       surfels.
+
+       The visited surfels are marked in a bitmap indexed by their
+       Khalimsky coordinates, the values of the predicate are cached
+       in a bitmap of the spels, and the surfels of each level of the
+       breadth-first traversal are processed in parallel. The bitmaps
+       use about (n+2) bits per spel of the space, so that this
+       function is meant for spaces whose bounds fit tightly the shape.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. Its operator() must
+       be safe to call concurrently from several threads.
+
+       @param[out] surface the surfels of the boundary component of
+       [pp] which touches [start_surfel], sorted as in a std::set
+       (previous content is discarded).
+
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of concepts::CPointPredicate,
+       which should be at least partially included in the bounds of
+       space [K].
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @param closed when 'true', the surface is known to be closed,
+       hence only direct orientations are followed.
+
+       @param nbThreads the number of threads (0 means
+       functions::parallelNbThreads()).
+    */
+    template <typename PointPredicate >
+    static
+    void trackBoundaryWithBitmaps( std::vector<SCell> & surface,
+                                   const KSpace & K,
+                                   const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                   const PointPredicate & pp,
+                                   const SCell & start_surfel,
+                                   bool closed = false,
+                                   unsigned int nbThreads = 0 );
+
     /**
        Function that extracts a n-1 digital surface (specified by a
        predicate on surfel), closed or open, in a nD KSpace. The
@@ -776,6 +943,81 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Fills the vector @a aBoundary with the unsigned surfels
+       representing all the boundary components of a digital shape
+       described by the predicate [pp]. The result is the same as the
+       one of uMakeBoundary with a std::set, but the surfels are
+       stored in a vector, sorted and without duplicates.
+
+       The domain is cut into slabs along the last axis, which are
+       scanned line by line in parallel: each spel is evaluated once
+       by [pp] and compared with its successor along every axis. Each
+       slab sorts its surfels, then the slabs are merged.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. Its operator() must
+       be safe to call concurrently from several threads (like an
+       image or a digital set lookup).
+
+       @param[out] aBoundary the sorted vector of boundary surfels
+       (previous content is discarded).
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbThreads the number of threads (0 means
+       functions::parallelNbThreads()).
+    */
+    template <typename PointPredicate >
+    static
+    void uMakeSortedBoundary( std::vector<Cell> & aBoundary,
+                              const KSpace & aKSpace,
+                              const PointPredicate & pp,
+                              const Point & aLowerBound,
+                              const Point & aUpperBound,
+                              unsigned int nbThreads = 0 );
+
+    /**
+       Fills the vector @a aBoundary with the signed surfels
+       representing all the boundary components of a digital shape
+       described by the predicate [pp]. The result is the same as the
+       one of sMakeBoundary with a std::set (hence a KSpace::SurfelSet
+       may be built from it in linear time), but the surfels are
+       stored in a vector, sorted and without duplicates.
+
+       @see uMakeSortedBoundary for the scanning method.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of a digital shape. Its operator() must
+       be safe to call concurrently from several threads.
+
+       @param[out] aBoundary the sorted vector of boundary surfels
+       (previous content is discarded).
+
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbThreads the number of threads (0 means
+       functions::parallelNbThreads()).
+    */
+    template <typename PointPredicate >
+    static
+    void sMakeSortedBoundary( std::vector<SCell> & aBoundary,
+                              const KSpace & aKSpace,
+                              const PointPredicate & pp,
+                              const Point & aLowerBound,
+                              const Point & aUpperBound,
+                              unsigned int nbThreads = 0 );
     
 
     
@@ -914,6 +1156,29 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Common implementation of uMakeSortedBoundary and
+       sMakeSortedBoundary.
+
+       @param[out] aBoundary the sorted vector of boundary surfels.
+       @param aKSpace any space.
+       @param pp the shape predicate.
+       @param aLowerBound and @param aUpperBound the bounds.
+       @param nbThreads the number of threads (0 means all).
+       @param makeSurfel a functor (Point p, Dimension k, bool in_p) ->
+       CellType returning the surfel between p and p+e_k.
+    */
+    template <typename CellType, typename PointPredicate,
+              typename SurfelMaker >
+    static
+    void makeSortedBoundary( std::vector<CellType> & aBoundary,
+                             const KSpace & aKSpace,
+                             const PointPredicate & pp,
+                             const Point & aLowerBound,
+                             const Point & aUpperBound,
+                             unsigned int nbThreads,
+                             const SurfelMaker & makeSurfel );
+
   }; // end of class Surfaces
 
 
@@ -0,0 +1,166 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class FlatMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <map>
+#include <vector>
+#include <utility>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/FlatMap.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/base/SetFunctions.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+using namespace std;
+
+typedef FlatMap<int, int>  Map;
+typedef std::map<int, int> RefMap;
+
+static bool sameElements( const Map & m, const RefMap & r )
+{
+  return m.size() == r.size()
+    && std::equal( m.begin(), m.end(), r.begin(),
+                   [] ( const Map::value_type & a, const RefMap::value_type & b )
+                   { return a.first == b.first && a.second == b.second; } );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Test cases
+
+TEST_CASE( "FlatMap concepts and traits" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Map > ));
+  REQUIRE( IsPairAssociativeContainer< Map >::value );
+  REQUIRE( IsOrderedAssociativeContainer< Map >::value );
+  REQUIRE( IsUniqueAssociativeContainer< Map >::value );
+}
+
+TEST_CASE( "FlatMap behaves as std::map" )
+{
+  srand( 0 );
+  Map m;
+  RefMap r;
+
+  SECTION( "Single insertions, lookups and erasures" )
+    {
+      for ( int i = 0; i < 1000; ++i )
+        {
+          const int k = rand() % 500;
+          const int v = rand();
+          REQUIRE( m.insert( std::make_pair( k, v ) ).second
+                   == r.insert( std::make_pair( k, v ) ).second );
+        }
+      REQUIRE( m.isValid() );
+      REQUIRE( sameElements( m, r ) );
+      for ( int k = -1; k <= 500; ++k )
+        {
+          REQUIRE( m.count( k ) == r.count( k ) );
+          REQUIRE( ( m.find( k ) == m.end() ) == ( r.find( k ) == r.end() ) );
+        }
+      for ( int i = 0; i < 300; ++i )
+        {
+          const int k = rand() % 500;
+          REQUIRE( m.erase( k ) == r.erase( k ) );
+        }
+      m[ 1000 ] = 3; r[ 1000 ] = 3;
+      m[ 1000 ] += 1; r[ 1000 ] += 1;
+      REQUIRE( m.at( 1000 ) == 4 );
+      REQUIRE( sameElements( m, r ) );
+      REQUIRE_THROWS( m.at( 2000 ) );
+    }
+
+  SECTION( "Hinted insertions in increasing order" )
+    {
+      for ( int k = 0; k < 1000; k += 2 )
+        m.insert( m.end(), std::make_pair( k, k ) );
+      m.insert( m.begin(), std::make_pair( 3, 3 ) ); // wrong hint
+      m.insert( m.end(), std::make_pair( 4, 5 ) );   // existing key
+      REQUIRE( m.isValid() );
+      REQUIRE( m.size() == 501 );
+      REQUIRE( m.at( 3 ) == 3 );
+      REQUIRE( m.at( 4 ) == 4 );
+    }
+
+  SECTION( "Range insertions keep the existing data" )
+    {
+      std::vector< std::pair<int, int> > values;
+      for ( int i = 0; i < 1000; ++i )
+        values.push_back( std::make_pair( rand() % 700, i ) );
+      m.insert( values.begin(), values.begin() + 500 );
+      r.insert( values.begin(), values.begin() + 500 );
+      m.insert( values.begin() + 500, values.end() );
+      r.insert( values.begin() + 500, values.end() );
+      REQUIRE( m.isValid() );
+      REQUIRE( sameElements( m, r ) );
+    }
+
+  SECTION( "Range insertions with assignment replace the data" )
+    {
+      std::vector< std::pair<int, int> > values;
+      for ( int i = 0; i < 1000; ++i )
+        values.push_back( std::make_pair( rand() % 700, i ) );
+      m.insert_or_assign( values.begin(), values.begin() + 500 );
+      m.insert_or_assign( values.begin() + 500, values.end() );
+      for ( const auto & v : values ) r[ v.first ] = v.second;
+      REQUIRE( m.isValid() );
+      REQUIRE( sameElements( m, r ) );
+    }
+
+  SECTION( "Erasure by predicate" )
+    {
+      for ( int k = 0; k < 1000; ++k ) m[ k ] = k * k;
+      REQUIRE( m.erase_if( [] ( const Map::value_type & v )
+                           { return v.first % 3 == 0; } ) == 334 );
+      REQUIRE( m.size() == 666 );
+      REQUIRE( m.isValid() );
+      REQUIRE( m.count( 3 ) == 0 );
+      REQUIRE( m.at( 4 ) == 16 );
+    }
+}
+
+TEST_CASE( "FlatMap set operations" )
+{
+  using namespace DGtal::functions::setops;
+  Map m1, m2;
+  RefMap r1, r2;
+  for ( int k = 0; k < 100; k += 2 ) { m1[ k ] = k; r1[ k ] = k; }
+  for ( int k = 0; k < 100; k += 3 ) { m2[ k ] = k; r2[ k ] = k; }
+
+  REQUIRE( sameElements( m1 | m2, r1 | r2 ) );
+  REQUIRE( sameElements( m1 & m2, r1 & r2 ) );
+  REQUIRE( sameElements( m1 - m2, r1 - r2 ) );
+  REQUIRE( sameElements( m1 ^ m2, r1 ^ r2 ) );
+  REQUIRE( DGtal::functions::isSubset( m1 & m2, m1 ) );
+  REQUIRE( ( m1 | m2 ).isValid() );
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
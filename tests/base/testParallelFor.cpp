@@ -0,0 +1,87 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing functions::parallelFor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <atomic>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+// Test cases
+
+TEST_CASE( "parallelFor visits each index exactly once" )
+{
+  const std::size_t n = 10007;
+
+  SECTION( "Default number of threads" )
+    {
+      REQUIRE( functions::parallelNbThreads() >= 1 );
+      std::vector<int> visits( n, 0 );
+      functions::parallelFor( 0, n, [&] ( std::size_t i ) { visits[ i ] += 1; } );
+      for ( std::size_t i = 0; i < n; ++i )
+        REQUIRE( visits[ i ] == 1 );
+    }
+
+  SECTION( "Several threads and chunks" )
+    {
+      for ( unsigned int nbThreads = 1; nbThreads <= 4; ++nbThreads )
+        for ( std::size_t chunk : { 1, 7, 256, 20000 } )
+          {
+            std::vector<int> visits( n, 0 );
+            std::atomic<std::size_t> sum( 0 );
+            functions::parallelFor( 3, n, [&] ( std::size_t i )
+              {
+                visits[ i ] += 1;
+                sum += i;
+              }, nbThreads, chunk );
+            REQUIRE( visits[ 0 ] == 0 );
+            REQUIRE( visits[ 2 ] == 0 );
+            for ( std::size_t i = 3; i < n; ++i )
+              REQUIRE( visits[ i ] == 1 );
+            REQUIRE( sum == n * ( n - 1 ) / 2 - 3 );
+          }
+    }
+
+  SECTION( "Empty range" )
+    {
+      std::size_t count = 0;
+      functions::parallelFor( 5, 5, [&] ( std::size_t ) { ++count; }, 4 );
+      functions::parallelFor( 5, 2, [&] ( std::size_t ) { ++count; }, 4 );
+      REQUIRE( count == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
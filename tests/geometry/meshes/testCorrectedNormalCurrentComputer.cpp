@@ -326,5 +326,81 @@ SCENARIO( "CorrectedNormalCurrentComputer CCNC convergence tests", "[ccnc][conve
   }
 }
 
+SCENARIO( "CorrectedNormalCurrentComputer measures in balls tests", "[cnc][balls]" )
+{
+  using namespace Z3i;
+  typedef SurfaceMesh< RealPoint, RealVector >       SM;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > SMH;
+  typedef CorrectedNormalCurrentComputer< RealPoint, RealVector > CNCComputer;
+
+  // Checks that the measures of all the balls computed in parallel
+  // with the face grid are the measures computed face by face.
+  auto check = [] ( const SM& smesh, double r )
+    {
+      CNCComputer cnc_computer( smesh, false );
+      auto mu0  = cnc_computer.computeMu0();
+      auto mu1  = cnc_computer.computeMu1();
+      auto mu2  = cnc_computer.computeMu2();
+      auto muXY = cnc_computer.computeMuXY();
+      auto measures = cnc_computer.computeMeasuresInBalls( r );
+      double error = 0.0;
+      for ( SM::Face f = 0; f < smesh.nbFaces(); ++f )
+        {
+          const RealPoint x = smesh.faceCentroid( f );
+          error = std::max( error, fabs( std::get< 0 >( measures )[ f ] - mu0.measure( x, r, f ) ) );
+          error = std::max( error, fabs( std::get< 1 >( measures )[ f ] - mu1.measure( x, r, f ) ) );
+          error = std::max( error, fabs( std::get< 2 >( measures )[ f ] - mu2.measure( x, r, f ) ) );
+          const auto dXY = std::get< 3 >( measures )[ f ] - muXY.measure( x, r, f );
+          for ( int j = 0; j < 3; j++ )
+            for ( int k = 0; k < 3; k++ )
+              error = std::max( error, fabs( dXY( j, k ) ) );
+        }
+      return error;
+    };
+
+  GIVEN( "A discretized sphere of radius 1 with interpolated normals" ) {
+    SM sphere = SMH::makeSphere( 1.0, RealPoint { 0.0, 0.0, 0.0 }, 20, 20,
+                                 SMH::NormalsType::VERTEX_NORMALS );
+    THEN( "The measures in balls are the measures computed face by face" ) {
+      REQUIRE( check( sphere, 0.3 )      < 1e-10 );
+      REQUIRE( check( sphere, 0.05 )     < 1e-10 );
+      REQUIRE( check( sphere, 0.0000001 ) < 1e-10 );
+    }
+    THEN( "The face grid finds the faces found by breadth-first traversal" ) {
+      SurfaceMeshFaceGrid< RealPoint, RealVector > grid( sphere, 0.3 );
+      REQUIRE( grid.isValid() );
+      for ( SM::Face f = 0; f < sphere.nbFaces(); ++f )
+        {
+          auto wfaces = sphere.computeFacesInclusionsInBall( 0.3, f );
+          std::sort( wfaces.begin(), wfaces.end() );
+          REQUIRE( grid.computeFacesInclusionsInBall( 0.3, sphere.faceCentroid( f ) ) == wfaces );
+        }
+    }
+    THEN( "A tiny cell size is enlarged to a bounded number of cells" ) {
+      SurfaceMeshFaceGrid< RealPoint, RealVector > grid( sphere, 1e-300 );
+      REQUIRE( grid.isValid() );
+      REQUIRE( grid.nbCells() <= std::max( std::size_t( 1024 ), 8 * sphere.nbFaces() ) );
+      auto wfaces = sphere.computeFacesInclusionsInBall( 0.3, 0 );
+      std::sort( wfaces.begin(), wfaces.end() );
+      REQUIRE( grid.computeFacesInclusionsInBall( 0.3, sphere.faceCentroid( 0 ) ) == wfaces );
+    }
+  }
+  GIVEN( "A discretized sphere of radius 1 with face normals" ) {
+    SM sphere = SMH::makeSphere( 1.0, RealPoint { 0.0, 0.0, 0.0 }, 20, 20,
+                                 SMH::NormalsType::FACE_NORMALS );
+    THEN( "The measures in balls are the measures computed face by face" ) {
+      REQUIRE( check( sphere, 0.3 )  < 1e-10 );
+      REQUIRE( check( sphere, 0.05 ) < 1e-10 );
+    }
+  }
+  GIVEN( "A discretized lantern with face normals" ) {
+    SM lantern = SMH::makeLantern( 1.0, 1.0, RealPoint { 0.0, 0.0, 0.0 }, 30, 12,
+                                   SMH::NormalsType::FACE_NORMALS );
+    THEN( "The measures in balls are the measures computed face by face" ) {
+      REQUIRE( check( lantern, 0.2 ) < 1e-10 );
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
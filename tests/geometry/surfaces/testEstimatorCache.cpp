@@ -22,20 +22,30 @@
  *
  * @date 2014/09/30
  *
- * Functions for testing class EstimatorCache.
+ * Functions for testing classes EstimatorCache and IndexedEstimatorCache.
  *
  * This file is part of the DGtal library.
  */
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
+#include "DGtal/geometry/surfaces/estimation/IndexedEstimatorCache.h"
 ///
 /// Shape
 #include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/ShapeGeometricFunctors.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
 
  /// Digitization
 #include "DGtal/shapes/GaussDigitizer.h"
@@ -47,6 +57,7 @@
 /// Estimator
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/TrueDigitalSurfaceLocalEstimator.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -188,6 +199,159 @@ bool testEstimatorCache(double h)
   return nbok == nb;
 }
 
+/**
+ * Checks that IndexedEstimatorCache gives the values of the
+ * estimator, by surfel and by index, when filled sequentially or in
+ * parallel, and after a save/load round trip.
+ *
+ */
+bool testIndexedEstimatorCache(double h)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef Z3i::KSpace::Surfel Surfel;
+
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef IndexedEstimatorCache<MyIICurvatureEstimator> GaussianCache;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<GaussianCache> ));
+
+  double re = 5.0;
+  double radius = 5.0;
+
+  trace.beginBlock( "Shape initialisation ..." );
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  std::vector<Surfel> surfels( surf.begin(), surf.end() );
+  trace.endBlock();
+
+  trace.beginBlock( "Caching curvatures by index ...");
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+  MyIICurvatureEstimator curvatureEstimator( curvatureFunctor );
+  curvatureEstimator.attach( K, dshape );
+  curvatureEstimator.setParams( re/h );
+  curvatureEstimator.init( h, surfels.begin(), surfels.end() );
+  GaussianCache cache( curvatureEstimator );
+  cache.init( h, surfels.begin(), surfels.end() );
+  trace.info() << cache << std::endl;
+  bool ok = cache.size() == surfels.size();
+  for ( std::size_t i = 0; i < surfels.size(); ++i )
+    {
+      const MyIICurvatureEstimator::Quantity q = curvatureEstimator.eval( surfels.begin() + i );
+      ok = ok && cache.index( surfels[ i ] ) == i
+        && cache.eval( i ) == q && cache.eval( surfels[ i ] ) == q
+        && cache.eval( surfels.begin() + i ) == q;
+    }
+  ok = ok && cache.eval( 0 ) == cache.eval( surfels[ 0 ] )
+    && cache.eval( (int) surfels.size() - 1 ) == cache.eval( surfels.back() );
+  ok = ok && cache.index( K.sOpp( surfels[ 0 ] ) ) == cache.size();
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "indexed cache == eval" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Saving and loading the cache ...");
+  const std::string filename = "testIndexedEstimatorCache.cache";
+  GaussianCache loaded( curvatureEstimator );
+  ok = cache.save( filename ) && loaded.load( filename, K )
+    && loaded.surfels() == cache.surfels() && loaded.values() == cache.values()
+    && loaded.index( surfels.back() ) == surfels.size() - 1;
+  // a cache without estimator can be loaded and queried
+  GaussianCache alone;
+  ok = ok && alone.load( filename, K ) && alone.h() == h
+    && alone.values() == cache.values();
+  std::remove( filename.c_str() );
+  ok = ok && ! loaded.load( filename, K );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "load( save( cache ) ) == cache" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Loading truncated or corrupt caches ...");
+  ok = cache.save( filename );
+  std::string bytes;
+  {
+    std::ifstream in( filename.c_str(), std::ios::in | std::ios::binary );
+    bytes.assign( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+  }
+  // truncated file: the header announces more surfels than stored
+  {
+    std::ofstream out( filename.c_str(), std::ios::out | std::ios::binary );
+    out.write( bytes.data(), bytes.size() - 1 );
+  }
+  ok = ok && ! loaded.load( filename, K );
+  // huge number of surfels in the header (after the 12-byte magic string)
+  const DGtal::uint64_t huge = (DGtal::uint64_t) 1 << 60;
+  bytes.replace( 12, sizeof( huge ), reinterpret_cast<const char*>( &huge ), sizeof( huge ) );
+  {
+    std::ofstream out( filename.c_str(), std::ios::out | std::ios::binary );
+    out.write( bytes.data(), bytes.size() );
+  }
+  ok = ok && ! loaded.load( filename, K )
+    && loaded.values() == cache.values();
+  std::remove( filename.c_str() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "load( corrupt cache ) fails" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Caching true normals in parallel ...");
+  typedef Z3i::Space::RealPoint::Coordinate Ring;
+  typedef MPolynomial<3, Ring> Polynomial3;
+  typedef MPolynomialReader<3, Ring> Polynomial3Reader;
+  typedef ImplicitPolynomial3Shape<Z3i::Space> PolynomialShape;
+  typedef functors::ShapeGeometricFunctors::ShapeNormalVectorFunctor<PolynomialShape> NormalFunctor;
+  typedef TrueDigitalSurfaceLocalEstimator<Z3i::KSpace, PolynomialShape, NormalFunctor> TrueNormalEstimator;
+  typedef IndexedEstimatorCache<TrueNormalEstimator> NormalCache;
+  std::string poly_str = "x^2+y^2+z^2-25";
+  Polynomial3 poly;
+  Polynomial3Reader reader;
+  reader.read( poly, poly_str.begin(), poly_str.end() );
+  CountedPtr<PolynomialShape> pshape( new PolynomialShape( poly ) );
+  TrueNormalEstimator normalEstimator;
+  normalEstimator.setParams( K, NormalFunctor() );
+  normalEstimator.attach( pshape );
+  normalEstimator.init( h, surfels.begin(), surfels.end() );
+  NormalCache ncache( normalEstimator );
+  ncache.setNbThreads( 0 );
+  ncache.init( h, surfels.begin(), surfels.end() );
+  ok = ncache.size() == surfels.size();
+  for ( std::size_t i = 0; i < surfels.size(); ++i )
+    ok = ok && ncache.eval( i ) == normalEstimator.eval( surfels.begin() + i );
+  const std::string nfilename = "testIndexedEstimatorCacheNormals.cache";
+  NormalCache nloaded( normalEstimator );
+  ok = ok && ncache.save( nfilename ) && nloaded.load( nfilename, K )
+    && nloaded.values() == ncache.values();
+  std::remove( nfilename.c_str() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallel indexed cache == eval" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -199,7 +363,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testEstimatorCache( 0.8 ); // && ... other tests
+  bool res = testEstimatorCache( 0.8 )
+    && testIndexedEstimatorCache( 0.8 ); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
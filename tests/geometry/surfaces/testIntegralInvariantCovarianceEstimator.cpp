@@ -275,13 +275,95 @@ bool testPrincipalCurvatures3d( double h )
   return true;
 }
 
+bool testParallelBatches3d( double h )
+{
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> MyIICurvatureFunctor;
+  typedef IntegralInvariantCovarianceEstimator< Z3i::KSpace, DigitalShape, MyIICurvatureFunctor > MyIICurvatureEstimator;
+  typedef MyIICurvatureFunctor::Value Value;
+
+  double re = 3;
+  double radius = 5;
+
+  trace.beginBlock( "Comparing sequential and parallel evaluations ..." );
+
+  ImplicitShape ishape( Z3i::RealPoint( 0, 0, 0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    trace.endBlock();
+    return false;
+  }
+
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Z3i::SCell > surfels( range.begin(), range.end() );
+
+  MyIICurvatureFunctor curvatureFunctor;
+  curvatureFunctor.init( h, re );
+
+  MyIICurvatureEstimator curvatureEstimator( curvatureFunctor );
+  curvatureEstimator.attach( K, dshape );
+  curvatureEstimator.setParams( re/h );
+  curvatureEstimator.init( h, surfels.begin(), surfels.end() );
+
+  // Sequential evaluation in depth-first order.
+  curvatureEstimator.setNbThreads( 1 );
+  std::vector< Value > sequential;
+  curvatureEstimator.eval( surfels.begin(), surfels.end(), std::back_inserter( sequential ) );
+
+  // Parallel evaluation of the shuffled surfels (Morton order batches).
+  std::vector< std::size_t > shuffle( surfels.size() );
+  std::vector< Z3i::SCell > shuffled( surfels.size() );
+  for ( std::size_t i = 0; i < surfels.size(); ++i )
+  {
+    shuffle[ i ] = ( i * 7919 ) % surfels.size();
+    shuffled[ i ] = surfels[ shuffle[ i ] ];
+  }
+  curvatureEstimator.setNbThreads( 4 );
+  std::vector< Value > parallel;
+  curvatureEstimator.eval( shuffled.begin(), shuffled.end(), std::back_inserter( parallel ) );
+
+  // The shifting masks may drift by a few points between two orders.
+  bool res = surfels.size() > 4 * detail::SurfelBatches< Z3i::KSpace >::minBatchSize
+    && parallel.size() == sequential.size();
+  double maxDiff = 0.0;
+  for ( std::size_t i = 0; res && i < surfels.size(); ++i )
+    maxDiff = std::max( maxDiff, std::abs( parallel[ i ] - sequential[ shuffle[ i ] ] ) );
+  res = res && maxDiff < 1e-3;
+
+  // With one thread, a single batch keeps the given order.
+  const detail::SurfelBatches< Z3i::KSpace > single( K, shuffled, 1 );
+  res = res && single.size() == 1 && single.end( 0 ) == shuffled.size();
+  for ( std::size_t k = 0; res && k < shuffled.size(); ++k )
+    res = single.index( k ) == k;
+
+  trace.info() << surfels.size() << " surfels, max |sequential - parallel|: " << maxDiff << std::endl;
+  trace.endBlock();
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegralInvariantCovarianceEstimator and 3d functors" );
-    bool res = testGaussianCurvature3d( 0.6, 0.007 ) && testPrincipalCurvatures3d( 0.6 );
+    bool res = testGaussianCurvature3d( 0.6, 0.007 ) && testPrincipalCurvatures3d( 0.6 )
+      && testParallelBatches3d( 0.3 );
     trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
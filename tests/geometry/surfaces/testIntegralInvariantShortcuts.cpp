@@ -86,4 +86,39 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
   }
 }
 
+TEST_CASE( "Testing IntegralInvariant Shortcuts API with the sweep engine" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters() |  SHG3::parametersGeometryEstimation();
+  params( "polynomial", "goursat" )( "gridstep", 1. )( "r-radius", 3.0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+
+  auto H_masks = SHG3::getIIMeanCurvatures( binary_image, surfels, params( "iiEngine", "masks" ) );
+  auto G_masks = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+  auto H_sweep = SHG3::getIIMeanCurvatures( binary_image, surfels, params( "iiEngine", "sweep" ) );
+  auto G_sweep = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+
+  SECTION("Testing that the masks and sweep engines give the same curvatures")
+  {
+    REQUIRE( H_masks.size() == surfels.size() );
+    REQUIRE( H_sweep.size() == surfels.size() );
+    REQUIRE( G_sweep.size() == surfels.size() );
+    for(std::size_t i = 0; i < surfels.size(); ++i)
+    {
+      REQUIRE( H_sweep[i] == Approx( H_masks[i] ).margin( 1e-6 ) );
+      REQUIRE( G_sweep[i] == Approx( G_masks[i] ).margin( 1e-6 ) );
+    }
+  }
+
+  SECTION("Testing that an unknown engine is rejected")
+  {
+    REQUIRE( SHG3::getIIMeanCurvatures( binary_image, surfels, params( "iiEngine", "swep" ) ).empty() );
+    REQUIRE( SHG3::getIINormalVectors( binary_image, surfels, params ).empty() );
+  }
+}
+
 /** @ingroup Tests **/
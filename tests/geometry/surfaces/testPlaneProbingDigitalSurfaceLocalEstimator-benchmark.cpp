@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPlaneProbingDigitalSurfaceLocalEstimator-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Timings of PlaneProbingDigitalSurfaceLocalEstimator with the H, R
+ * and R1 neighborhoods, and of the queries of DigitalSurfacePredicate.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/kernel/UnorderedSetByBlock.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingTetrahedronEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingDigitalSurfaceLocalEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace>                    SH3;
+typedef SH3::DigitalSurface                       Surface;
+typedef DigitalSurfacePredicate<Surface>          SurfacePredicate;
+
+/// @return the time elapsed since @a start, in microseconds.
+double elapsed( std::chrono::high_resolution_clock::time_point start )
+{
+  return std::chrono::duration<double, std::micro>
+    ( std::chrono::high_resolution_clock::now() - start ).count();
+}
+
+/**
+ * Timings of an estimator on all the surfels, surfel by surfel, then
+ * with the range evaluation on one thread and on all the threads.
+ */
+template <ProbingMode mode>
+bool runProbing( const std::string & name, CountedPtr<Surface> surface,
+                 const SH3::SurfelRange & surfels )
+{
+  typedef PlaneProbingTetrahedronEstimator<SurfacePredicate, mode> Algorithm;
+  typedef PlaneProbingDigitalSurfaceLocalEstimator<Surface, Algorithm> Estimator;
+  Estimator estimator
+    ( surface, [] ( const typename Estimator::ProbingFrame & frame, const SurfacePredicate & predicate )
+      { return new Algorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate ); } );
+  estimator.init( 1.0, surfels.begin(), surfels.end() );
+  // Computes the pre-estimations, so that only the probing is timed.
+  std::vector<typename Estimator::Quantity> normals;
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( normals ) );
+  const double n = surfels.size();
+
+  trace.beginBlock( name + "-neighborhood" );
+  auto start = std::chrono::high_resolution_clock::now();
+  for ( auto it = surfels.begin(); it != surfels.end(); ++it )
+    normals.push_back( estimator.eval( it ) );
+  trace.info() << "surfel by surfel: " << elapsed( start ) / n << " us/surfel" << std::endl;
+
+  normals.clear();
+  start = std::chrono::high_resolution_clock::now();
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( normals ) );
+  trace.info() << "range, 1 thread: " << elapsed( start ) / n << " us/surfel" << std::endl;
+
+  normals.clear();
+  estimator.setNbThreads( 0 );
+  start = std::chrono::high_resolution_clock::now();
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( normals ) );
+  trace.info() << "range, " << functions::parallelNbThreads() << " threads: "
+               << elapsed( start ) / n << " us/surfel" << std::endl;
+  trace.endBlock();
+  return normals.size() == surfels.size();
+}
+
+/**
+ * Timings of the queries of the predicate, compared to a set of
+ * pointels.
+ */
+bool runPredicate( CountedPtr<Surface> surface )
+{
+  trace.beginBlock( "InPlane predicate queries" );
+  SurfacePredicate predicate( surface );
+  const Z3i::KSpace & K = surface->container().space();
+  UnorderedSetByBlock<Z3i::Point> pointels;
+  for ( auto s : *surface )
+    for ( auto c : K.uFaces( K.unsigns( s ) ) )
+      if ( K.uDim( c ) == 0 ) pointels.insert( K.uCoords( c ) );
+
+  // Queries around the pointels, half of them are pointels.
+  std::vector<Z3i::Point> queries;
+  for ( auto p : pointels )
+    {
+      queries.push_back( p );
+      queries.push_back( p + Z3i::Point( rand() % 5 - 2, rand() % 5 - 2, rand() % 5 - 2 ) );
+    }
+  const int nbPasses = 20;
+  const double n = nbPasses * queries.size();
+  std::size_t nb1 = 0, nb2 = 0;
+  auto start = std::chrono::high_resolution_clock::now();
+  for ( int i = 0; i < nbPasses; ++i )
+    for ( auto p : queries ) nb1 += predicate( p ) ? 1 : 0;
+  trace.info() << "DigitalSurfacePredicate (" << ( predicate.isDense() ? "bitmap" : "set" )
+               << "): " << 1000.0 * elapsed( start ) / n << " ns/query" << std::endl;
+  start = std::chrono::high_resolution_clock::now();
+  for ( int i = 0; i < nbPasses; ++i )
+    for ( auto p : queries ) nb2 += pointels.count( p );
+  trace.info() << "UnorderedSetByBlock: " << 1000.0 * elapsed( start ) / n << " ns/query" << std::endl;
+  trace.endBlock();
+  return nb1 == nb2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking PlaneProbingDigitalSurfaceLocalEstimator" );
+  const double h = ( argc > 1 ) ? atof( argv[ 1 ] ) : 0.5;
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", h );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  trace.info() << "goursat, h=" << h << ", " << surfels.size() << " surfels" << std::endl;
+
+  bool res = runPredicate( surface )
+    && runProbing<ProbingMode::H>( "H", surface, surfels )
+    && runProbing<ProbingMode::R>( "R", surface, surfels )
+    && runProbing<ProbingMode::R1>( "R1", surface, surfels );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPlaneProbingDigitalSurfaceLocalEstimator.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes DigitalSurfacePredicate and
+ * PlaneProbingDigitalSurfaceLocalEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePredicate.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingTetrahedronEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingParallelepipedEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/PlaneProbingDigitalSurfaceLocalEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace> SH3;
+
+/// @return the pointels of the surfels of a digital surface.
+template <typename Surface>
+std::set<Z3i::Point> pointels( const Surface & surface )
+{
+  const Z3i::KSpace & K = surface.container().space();
+  std::set<Z3i::Point> result;
+  for ( auto s : surface )
+    for ( auto c : K.uFaces( K.unsigns( s ) ) )
+      if ( K.uDim( c ) == 0 ) result.insert( K.uCoords( c ) );
+  return result;
+}
+
+/// Checks a predicate against the pointels on the bounding box of the
+/// pointels, enlarged by one.
+template <typename Predicate>
+bool checkPredicate( const Predicate & predicate, const std::set<Z3i::Point> & points )
+{
+  Z3i::Point lo = *points.begin(), up = *points.begin();
+  for ( auto p : points ) { lo = lo.inf( p ); up = up.sup( p ); }
+  Z3i::Domain domain( lo - Z3i::Point::diagonal( 1 ), up + Z3i::Point::diagonal( 1 ) );
+  for ( auto p : domain )
+    if ( predicate( p ) != ( points.count( p ) == 1 ) ) return false;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PlaneProbingDigitalSurfaceLocalEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing DigitalSurfacePredicate" )
+{
+  SECTION( "A dense surface is stored in a bitmap" )
+    {
+      auto params = SH3::defaultParameters();
+      params( "polynomial", "goursat" )( "gridstep", 1. );
+      auto implicit_shape  = SH3::makeImplicitShape3D( params );
+      auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+      auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+      auto K               = SH3::getKSpace( params );
+      auto surface         = SH3::makeDigitalSurface( binary_image, K, params );
+      DigitalSurfacePredicate<SH3::DigitalSurface> predicate( surface );
+      REQUIRE( predicate.isDense() );
+      REQUIRE( checkPredicate( predicate, pointels( *surface ) ) );
+      DigitalSurfacePredicate<SH3::DigitalSurface> copy( predicate );
+      REQUIRE( checkPredicate( copy, pointels( *surface ) ) );
+    }
+
+  SECTION( "A sparse surface is stored in a set" )
+    {
+      typedef SetOfSurfels<Z3i::KSpace>   Container;
+      typedef DigitalSurface<Container>  Surface;
+      Z3i::KSpace K;
+      K.init( Z3i::Point::diagonal( -2 ), Z3i::Point::diagonal( 202 ), true );
+      Z3i::DigitalSet voxels( Z3i::Domain( Z3i::Point::diagonal( -2 ), Z3i::Point::diagonal( 202 ) ) );
+      voxels.insert( Z3i::Point::diagonal( 0 ) );
+      voxels.insert( Z3i::Point::diagonal( 200 ) );
+      Z3i::KSpace::SurfelSet surfels;
+      for ( auto p : voxels )
+        Surfaces<Z3i::KSpace>::sMakeBoundary( surfels, K, voxels,
+                                              p - Z3i::Point::diagonal( 1 ),
+                                              p + Z3i::Point::diagonal( 1 ) );
+      REQUIRE( surfels.size() == 12 );
+      Surface surface( new Container( K, SurfelAdjacency<3>( true ), surfels ) );
+      DigitalSurfacePredicate<Surface> predicate( surface );
+      REQUIRE( ! predicate.isDense() );
+      const std::set<Z3i::Point> points = pointels( surface );
+      REQUIRE( points.size() == 16 );
+      for ( auto p : points ) REQUIRE( predicate( p ) );
+      REQUIRE( ! predicate( Z3i::Point::diagonal( 100 ) ) );
+    }
+}
+
+TEST_CASE( "Testing PlaneProbingDigitalSurfaceLocalEstimator batch evaluation" )
+{
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1. );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+
+  typedef SH3::DigitalSurface Surface;
+  typedef DigitalSurfacePredicate<Surface> SurfacePredicate;
+
+  // Checks that the parallel evaluation on a range gives the same
+  // normals as the evaluation surfel by surfel. Each pass uses its own
+  // estimator, so that the pre-estimations of the parallel pass are
+  // all computed in parallel.
+  auto check = [&] ( auto makeEstimator )
+    {
+      auto parallelEstimator = makeEstimator();
+      parallelEstimator.init( 1.0, surfels.begin(), surfels.end() );
+      parallelEstimator.setNbThreads( 0 );
+      std::vector<Z3i::Point> sequential, parallel;
+      parallelEstimator.eval( surfels.begin(), surfels.end(), std::back_inserter( parallel ) );
+      auto estimator = makeEstimator();
+      estimator.init( 1.0, surfels.begin(), surfels.end() );
+      for ( auto it = surfels.begin(); it != surfels.end(); ++it )
+        sequential.push_back( estimator.eval( it ) );
+      return sequential == parallel;
+    };
+
+  SECTION( "Tetrahedron estimators with the H, R and R1 neighborhoods" )
+    {
+      typedef PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::H>  HAlgorithm;
+      typedef PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::R>  RAlgorithm;
+      typedef PlaneProbingTetrahedronEstimator<SurfacePredicate, ProbingMode::R1> R1Algorithm;
+      REQUIRE( check( [&] ()
+        { return PlaneProbingDigitalSurfaceLocalEstimator<Surface, HAlgorithm>
+            ( surface, [] ( const auto & frame, const SurfacePredicate & predicate )
+              { return new HAlgorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate ); } ); } ) );
+      REQUIRE( check( [&] ()
+        { return PlaneProbingDigitalSurfaceLocalEstimator<Surface, RAlgorithm>
+            ( surface, [] ( const auto & frame, const SurfacePredicate & predicate )
+              { return new RAlgorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate ); } ); } ) );
+      REQUIRE( check( [&] ()
+        { return PlaneProbingDigitalSurfaceLocalEstimator<Surface, R1Algorithm>
+            ( surface, [] ( const auto & frame, const SurfacePredicate & predicate )
+              { return new R1Algorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate ); } ); } ) );
+    }
+
+  SECTION( "Parallelepiped estimator" )
+    {
+      typedef PlaneProbingParallelepipedEstimator<SurfacePredicate, ProbingMode::R1> Algorithm;
+      const int bound = 100;
+      REQUIRE( check( [&] ()
+        { return PlaneProbingDigitalSurfaceLocalEstimator<Surface, Algorithm>
+            ( surface, [bound] ( const auto & frame, const SurfacePredicate & predicate )
+              { return new Algorithm( frame.p, { frame.b1, frame.b2, frame.normal }, predicate, bound ); } ); } ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
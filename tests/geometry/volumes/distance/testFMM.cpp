@@ -653,6 +653,62 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Comparison between the default (ordered) candidate queue 
+ * and the bucketed candidate queue
+ *
+ */
+bool testBucketQueue(int size)
+{
+
+  static const DGtal::Dimension dimension = 3; 
+
+  //Domain
+  typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+  DomainPredicate<Domain> dp(d);
+
+  //Images and sets
+  typedef ImageContainerBySTLMap<Domain,double> Image; 
+  typedef DigitalSetFromMap<Image> Set; 
+  Image map1( d, 0.0 ), map2( d, 0.0 ); 
+  Set set1(map1), set2(map2); 
+  //a few seeds
+  std::vector<Point> seeds; 
+  seeds.push_back( Point::diagonal(0) ); 
+  seeds.push_back( Point(size/2, -size/3, 1) ); 
+  seeds.push_back( Point(-size, size, -size) ); 
+
+  trace.beginBlock ( "FMM with ordered and bucketed queues " );
+
+  typedef L2SecondOrderLocalDistance<Image, Set> Distance; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance> FMM1; 
+  typedef FMM<Image, Set, DomainPredicate<Domain>, Distance, 
+	      FMMBucketCandidateQueue<Point, double> > FMM2; 
+
+  FMM1::initFromPointsRange( seeds.begin(), seeds.end(), map1, set1, 0.0 ); 
+  FMM2::initFromPointsRange( seeds.begin(), seeds.end(), map2, set2, 0.0 ); 
+  Distance dist1(map1, set1), dist2(map2, set2); 
+  FMM1 fmm1(map1, set1, dp, dist1); 
+  FMM2 fmm2(map2, set2, dp, dist2); 
+  fmm1.compute(); 
+  fmm2.compute(); 
+  trace.info() << fmm1 << std::endl; 
+  trace.info() << fmm2 << std::endl; 
+
+  bool flagIsOk = ( set1.size() == d.size() ) && ( set2.size() == d.size() ); 
+  for (Domain::ConstIterator it = d.begin(); 
+       ( (it != d.end())&&(flagIsOk) ); ++it)
+    {
+      if (map1(*it) != map2(*it)) 
+	flagIsOk = false; 
+    }
+  trace.endBlock();
+
+  return flagIsOk && fmm2.isValid(); 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -681,6 +737,10 @@ int main ( int argc, char** argv )
   res = res && testDisplayDT3d( size, area, std::sqrt(size*size*size) )
     ; 
 
+  //3d L2 with a bucketed queue
+  res = res && testBucketQueue( 10 )
+    ;
+
   //3d L1 and  comparison
   size = 20; 
   area = int( std::pow(double(2*size+1),3) )+1; 
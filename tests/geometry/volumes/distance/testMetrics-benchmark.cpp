@@ -33,6 +33,8 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/InexactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
 #include <boost/lexical_cast.hpp>
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -91,6 +93,56 @@ bool runATest( unsigned int maxTest)
 
 
 
+/**
+ * Timings of the predicates used by VoronoiMap (hiddenBy and
+ * closest) and of a whole 3D VoronoiMap.
+ */
+template<DGtal::uint32_t p>
+bool runPredicatesTest( unsigned int maxTest, int size )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, p> Metric;
+  Metric metric;
+  std::string txt = "Testing predicates, exponent " +   boost::lexical_cast<string>(p);
+  trace.beginBlock(txt);
+
+  //Random triples of sites sorted along dimension 0
+  const int dim = 1000;
+  std::vector<Z3i::Point> sites;
+  for(unsigned int i=0; i< 3*maxTest; ++i)
+    sites.push_back( Z3i::Point( 3*(i%3)*dim/10 + rand() % (dim/10),
+                                 rand() % dim, rand() % dim ) );
+  const Z3i::Point start( 0, dim/2, dim/2 ), end( dim, dim/2, dim/2 );
+
+  unsigned int nbHidden = 0;
+  trace.beginBlock("hiddenBy");
+  for(unsigned int i=0; i< maxTest; ++i)
+    nbHidden += metric.hiddenBy( sites[3*i], sites[3*i+1], sites[3*i+2], start, end, 0 ) ? 1 : 0;
+  trace.endBlock();
+
+  unsigned int nbFirst = 0;
+  trace.beginBlock("closest");
+  for(unsigned int i=0; i< maxTest; ++i)
+    nbFirst += ( metric.closest( sites[3*i], sites[3*i+1], sites[3*i+2] ) == ClosestFIRST ) ? 1 : 0;
+  trace.endBlock();
+  trace.info() << nbHidden << " hidden, " << nbFirst << " first closest" << std::endl;
+
+  //Voronoi map on a random set of sites
+  Z3i::Domain domain( Z3i::Point::diagonal(0), Z3i::Point::diagonal(size) );
+  Z3i::DigitalSet set( domain );
+  for(unsigned int i=0; i< 100; ++i)
+    set.insert( Z3i::Point( rand() % (size+1), rand() % (size+1), rand() % (size+1) ) );
+  typedef functors::NotPointPredicate<Z3i::DigitalSet> Predicate;
+  Predicate predicate( set );
+  trace.beginBlock("VoronoiMap");
+  VoronoiMap<Z3i::Space, Predicate, Metric> voronoi( domain, predicate, metric );
+  trace.endBlock();
+  trace.info() << voronoi( Z3i::Point::diagonal(size/2) ) << std::endl;
+
+  trace.endBlock();
+  return true;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -105,6 +157,9 @@ int main( int argc, char** argv )
   bool res = runATest<2>(1000000) &&
     runATest<4>(10000000);
     runATest<6>(1000000);
+  res = res && runPredicatesTest<1>(1000000, 128)
+    && runPredicatesTest<2>(1000000, 128)
+    && runPredicatesTest<3>(1000000, 128);
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -468,6 +468,41 @@ bool testSpecialCasesL2()
 }
 
 
+bool testClosedFormL1()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing closed form of the L1 Voronoi abscissa..." );
+  typedef ExactPredicateLpSeparableMetric<Z2i::Space, 1> Metric;
+  typedef Metric::Abscissa Abscissa;
+  typedef Metric::RawValue RawValue;
+  Metric metric;
+
+  //Comparison with an exhaustive scan of the interval
+  for ( Abscissa lower = -6; lower <= 0; lower += 3 )
+    for ( Abscissa upper = lower; upper <= lower + 12; upper += 4 )
+      for ( Abscissa udim = -8; udim <= 8; ++udim )
+        for ( Abscissa vdim = udim + 1; vdim <= 10; ++vdim )
+          for ( RawValue nu = 0; nu <= 6; ++nu )
+            for ( RawValue nv = 0; nv <= 6; ++nv )
+              {
+                const auto du = [&] ( Abscissa x ) { return nu + std::abs( udim - x ); };
+                const auto dv = [&] ( Abscissa x ) { return nv + std::abs( vdim - x ); };
+                if ( !( du( lower ) < dv( lower ) ) ) continue; //precondition
+                Abscissa expected = lower;
+                for ( Abscissa x = lower; x <= upper; ++x )
+                  if ( du( x ) < dv( x ) ) expected = x;
+                nbok += ( metric.binarySearchHidden( udim, vdim, nu, nv, lower, upper )
+                          == expected ) ? 1 : 0;
+                nb++;
+              }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "closed form == exhaustive scan" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 bool testConcepts()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CSeparableMetric<ExactPredicateLpSeparableMetric<Z2i::Space, 2> > ));
@@ -494,6 +529,7 @@ int main( int argc, char** argv )
     && testBinarySearch()
     && testSpecialCasesL2()
     && testSpecialCasesLp()
+    && testClosedFormL1()
     && testConcepts();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
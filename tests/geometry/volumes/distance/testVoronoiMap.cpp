@@ -501,6 +501,13 @@ bool testVoronoiMapFromSites( const Set &aSet, std::array<bool, Set::Space::dime
   nb++;
   trace.endBlock();
 
+  trace.beginBlock(" Voronoi computation l_2 with all the threads");
+  Voro2 parallelVoro(aSet.domain(), mySet, l2, periodicity, 0);
+  nbok += std::equal( voro.constRange().begin(), voro.constRange().end(),
+                      parallelVoro.constRange().begin() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
   trace.beginBlock(" Voronoi computation l_3");
   typedef ExactPredicateLpSeparableMetric<typename Set::Space,3> L3Metric;
   typedef VoronoiMap<typename Set::Space, Set, L3Metric> Voro3;
@@ -28,9 +28,12 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <cmath>
 #include <iostream>
 #include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/estimation/VoronoiCovarianceMeasure.h"
 #include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
@@ -106,6 +109,88 @@ bool testVoronoiCovarianceMeasure()
   return nbok == nb;
 }
 
+/**
+ * Checks that the flat storage of the VCM agrees with its map, and
+ * that the parallel accumulation does not depend on the number of
+ * threads.
+ */
+bool testFlatStorageAndThreads()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  using namespace DGtal;
+  using namespace DGtal::Z3i; // gets Space, Point, Domain
+  trace.beginBlock ( "testFlatStorageAndThreads" );
+  typedef ExactPredicateLpSeparableMetric<Space,2> Metric;
+  typedef VoronoiCovarianceMeasure<Space, Metric> VCM;
+  typedef VCM::MatrixNN Matrix;
+
+  // Points of a digital sphere, with duplicates.
+  std::vector<Point> pts;
+  Domain domain( Point::diagonal( -15 ), Point::diagonal( 15 ) );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const double d = ( *it ).norm();
+      if ( 11.5 <= d && d < 12.5 ) { pts.push_back( *it ); pts.push_back( *it ); }
+    }
+  Metric l2;
+  VCM vcm1( 5.0, 3.0, l2, false, 1 );
+  VCM vcm4( 5.0, 3.0, l2, false, 4 );
+  vcm1.init( pts.begin(), pts.end() );
+  vcm4.init( pts.begin(), pts.end() );
+  nbok += ( vcm1.points().size() * 2 == pts.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "#points=" << vcm1.points().size() << std::endl;
+  nbok += ( vcm1.vcms() == vcm4.vcms() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same VCM with 1 and 4 threads" << std::endl;
+  std::atomic<bool> ok_concurrent( true );
+  functions::parallelFor( 0, 8, [&] ( std::size_t )
+    {
+      if ( vcm4.vcmMap().size() != vcm4.points().size() ) ok_concurrent = false;
+    }, 4 );
+  nbok += ok_concurrent ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcmMap built concurrently" << std::endl;
+  bool ok_map = vcm1.vcmMap().size() == vcm1.points().size();
+  for ( VCM::Point2MatrixNN::const_iterator it = vcm1.vcmMap().begin(),
+          itE = vcm1.vcmMap().end(); it != itE; ++it )
+    ok_map = ok_map && ( vcm1.vcms()[ vcm1.index( it->first ) ] == it->second );
+  ok_map = ok_map && ( vcm1.index( Point::zero ) == vcm1.points().size() );
+  nbok += ok_map ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcmMap agrees with vcms and index" << std::endl;
+  functors::HatPointFunction< Point, double > chi_r( 1.0, 3.0 );
+  bool ok_measure = true;
+  for ( std::size_t i = 0; i < vcm1.points().size(); i += 17 )
+    {
+      const Point p = vcm1.points()[ i ];
+      // Brute force integration over all the points.
+      Matrix m;
+      for ( std::size_t j = 0; j < vcm1.points().size(); ++j )
+        {
+          const double coef = chi_r( vcm1.points()[ j ] - p );
+          if ( coef > 0.0 ) { Matrix mj = vcm1.vcms()[ j ]; mj *= coef; m += mj; }
+        }
+      Matrix diff = m - vcm4.measure( chi_r, p );
+      for ( Dimension r = 0; r < 3; ++r )
+        for ( Dimension c = 0; c < 3; ++c )
+          ok_measure = ok_measure && std::fabs( diff( r, c ) ) < 1e-6 * ( 1.0 + std::fabs( m( r, c ) ) );
+    }
+  nbok += ok_measure ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "measure agrees with brute force integration" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -114,7 +199,8 @@ int main( int /* argc */, char** /* argv */ )
   using namespace std;
   using namespace DGtal;
   trace.beginBlock ( "Testing VoronoiCovarianceMeasure ..." );
-  bool res = testVoronoiCovarianceMeasure();
+  bool res = testVoronoiCovarianceMeasure()
+    && testFlatStorageAndThreads();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
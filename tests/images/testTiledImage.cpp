@@ -29,11 +29,14 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <atomic>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/helpers/StdDefs.h"
 
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageFactoryWithPrefetch.h"
 #include "DGtal/images/TiledImage.h"
 
 #include "ConfigTest.h"
@@ -327,6 +330,378 @@ bool test_range_constRange()
     return nbok == nb;
 }
 
+bool testLRUAndPrefetch()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing LRU read policy and prefetch with TiledImage");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(1,1), Z2i::Point(10,10)));
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // tiles are 2x2 ints, the budget holds 3 tiles
+    const DGtal::uint64_t tileBytes = 4 * sizeof(int);
+
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 3*tileBytes);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWT> MyTiledImage;
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< MyTiledImage > ));
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWT, 4);
+
+    tiledImage(Z2i::Point(1,1)); // miss
+    tiledImage(Z2i::Point(3,1)); // miss
+    tiledImage(Z2i::Point(5,1)); // miss
+    tiledImage(Z2i::Point(1,1)); // hit, (1,1) tile becomes the most recently used
+    tiledImage(Z2i::Point(7,1)); // miss, (3,1) tile is evicted
+    tiledImage(Z2i::Point(2,2)); // hit
+    nbok += (tiledImage(Z2i::Point(4,2)) == 13) ? 1 : 0; nb++; // miss
+    trace.info() << "cacheMissRead:" << tiledImage.getCacheMissRead()
+                 << " cacheHitRead:" << tiledImage.getCacheHitRead()
+                 << " bytesLoaded:" << tiledImage.getBytesLoaded() << endl;
+    nbok += (tiledImage.getCacheMissRead() == 5) ? 1 : 0; nb++;
+    nbok += (tiledImage.getCacheHitRead() == 2) ? 1 : 0; nb++;
+    nbok += (tiledImage.getBytesLoaded() == 5*tileBytes) ? 1 : 0; nb++;
+    nbok += (imageCacheReadPolicyLRU.bytesInCache() == 3*tileBytes) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    tiledImage.clearCacheAndResetCacheMisses();
+    nbok += (tiledImage.getCacheMissRead() == 0 && tiledImage.getCacheHitRead() == 0
+             && tiledImage.getBytesLoaded() == 0) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // same traversal with tiles prefetched in background
+    typedef ImageFactoryWithPrefetch<MyImageFactoryFromImage> MyImageFactoryWithPrefetch;
+    MyImageFactoryWithPrefetch imageFactoryWithPrefetch(imageFactoryFromImage);
+
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryWithPrefetch> MyImageCacheReadPolicyLRU2;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryWithPrefetch> MyImageCacheWritePolicyWB2;
+    MyImageCacheReadPolicyLRU2 imageCacheReadPolicyLRU2(imageFactoryWithPrefetch, 3*tileBytes);
+    MyImageCacheWritePolicyWB2 imageCacheWritePolicyWB2(imageFactoryWithPrefetch);
+
+    typedef TiledImage<VImage, MyImageFactoryWithPrefetch, MyImageCacheReadPolicyLRU2, MyImageCacheWritePolicyWB2> MyTiledImage2;
+    BOOST_CONCEPT_ASSERT(( concepts::CImage< MyTiledImage2 > ));
+    MyTiledImage2 tiledImage2(imageFactoryWithPrefetch, imageCacheReadPolicyLRU2, imageCacheWritePolicyWB2, 4);
+
+    MyTiledImage2::Range::OutputIterator ito = tiledImage2.range().outputIterator();
+    for (int j = 0; j < 100; ++j)
+      *ito++ = 2*j;
+
+    MyTiledImage2::ConstRange r = tiledImage2.constRange();
+    bool ok = true;
+    int j = 0;
+    for (MyTiledImage2::ConstRange::ConstIterator it = r.begin(), itEnd = r.end(); it != itEnd; ++it, ++j)
+      ok = ok && (*it == 2*j);
+    ok = ok && (j == 100);
+    nbok += ok ? 1 : 0; nb++;
+    trace.info() << imageFactoryWithPrefetch << " cacheMissRead:" << tiledImage2.getCacheMissRead() << endl;
+    nbok += (imageFactoryWithPrefetch.getNbPrefetchHit() > 0) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testLRUByteBudget()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing LRU byte budget with pages of different sizes");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(9,9)));
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // the budget holds 3 pages of 2x2 ints
+    const DGtal::uint64_t budget = 3 * 4 * sizeof(int);
+
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, budget);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef ImageCache<OutputImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWT> MyImageCache;
+    MyImageCache imageCache(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWT);
+
+    Z2i::Domain d1(Z2i::Point(0,0), Z2i::Point(1,1));
+    Z2i::Domain d2(Z2i::Point(2,0), Z2i::Point(3,1));
+    Z2i::Domain d3(Z2i::Point(4,0), Z2i::Point(5,1));
+    Z2i::Domain d4(Z2i::Point(6,0), Z2i::Point(7,1));
+    Z2i::Domain dBig(Z2i::Point(0,4), Z2i::Point(2,6));
+
+    imageCache.update(d1);
+    imageCache.update(d2);
+    imageCache.update(d3);
+    nbok += (imageCacheReadPolicyLRU.bytesInCache() == budget) ? 1 : 0; nb++;
+
+    // findPage does not change the replacement order: d1 is still evicted first
+    nbok += (imageCache.findPage(d1) != NULL) ? 1 : 0; nb++;
+    imageCache.update(d4);
+    nbok += (imageCache.findPage(d1) == NULL && imageCache.findPage(d2) != NULL) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // a 3x3 page needs the room of the three 2x2 pages
+    imageCache.update(dBig);
+    trace.info() << "bytesInCache:" << imageCacheReadPolicyLRU.bytesInCache() << endl;
+    nbok += (imageCacheReadPolicyLRU.bytesInCache() == 9 * sizeof(int)) ? 1 : 0; nb++;
+    nbok += (imageCache.findPage(dBig) != NULL && imageCache.findPage(d4) == NULL) ? 1 : 0; nb++;
+
+    // and a 2x2 page does not fit next to it
+    imageCache.update(d1);
+    nbok += (imageCacheReadPolicyLRU.bytesInCache() == 4 * sizeof(int)) ? 1 : 0; nb++;
+    nbok += (imageCache.findPage(dBig) == NULL) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    imageCache.clearCacheAndResetCacheMisses();
+    nbok += (imageCacheReadPolicyLRU.bytesInCache() == 0 && imageCache.findPage(d1) == NULL) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testConcurrentAccess()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing concurrent access to TiledImage");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(63,63)));
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = 0;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // tiles are 8x8 ints, the budget holds 4 tiles
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 4 * 64 * sizeof(int));
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB, 8);
+    tiledImage.setConcurrentAccess(true);
+
+    const unsigned int nbThreads = 4;
+
+    // each thread writes its own rows
+    functions::parallelFor(0, 64, [&] (std::size_t y)
+    {
+      for (int x = 0; x < 64; ++x)
+        tiledImage.setValue(Z2i::Point(x, (int)y), x + 64*(int)y);
+    }, nbThreads);
+
+    // each thread reads the whole image
+    std::atomic<unsigned int> nbGoodRead(0);
+    functions::parallelFor(0, nbThreads, [&] (std::size_t)
+    {
+      bool ok = true;
+      for (int y = 0; y < 64; ++y)
+        for (int x = 0; x < 64; ++x)
+          ok = ok && (tiledImage(Z2i::Point(x, y)) == x + 64*y);
+      if (ok)
+        nbGoodRead++;
+    }, nbThreads);
+    nbok += (nbGoodRead == nbThreads) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // each thread scans the whole image with iterators, tiles are pinned
+    std::atomic<unsigned int> nbGoodScan(0);
+    functions::parallelFor(0, nbThreads, [&] (std::size_t)
+    {
+      MyTiledImage::ConstRange r = tiledImage.constRange();
+      std::vector<int> values(r.begin(), r.end());
+      int sum = 0;
+      for (std::size_t i = 0; i < values.size(); ++i)
+        sum += values[i];
+      if (values.size() == 64*64 && sum == (64*64)*(64*64-1)/2)
+        nbGoodScan++;
+    }, nbThreads);
+    trace.info() << "cacheMissRead:" << tiledImage.getCacheMissRead()
+                 << " cacheHitRead:" << tiledImage.getCacheHitRead() << endl;
+    nbok += (nbGoodScan == nbThreads) ? 1 : 0; nb++;
+    nbok += (tiledImage.getNbPinnedTiles() == 0) ? 1 : 0; nb++;
+    nbok += (imageCacheReadPolicyLRU.bytesInCache() <= 4 * 64 * sizeof(int)) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testPinnedTileEviction()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing writes in a pinned tile after its eviction");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(7,7)));
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = 0;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // tiles are 4x4 ints, the budget holds 1 tile
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 16 * sizeof(int));
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB, 2);
+    tiledImage.setConcurrentAccess(true);
+
+    OutputImage *tile = tiledImage.pinTileFromBlockCoords(Z2i::Point(0,0));
+    tiledImage(Z2i::Point(5,5)); // the pinned tile leaves the cache
+    nbok += (imageCacheReadPolicyLRU.findPage(tile->domain()) == NULL) ? 1 : 0; nb++;
+
+    // write through the pinned tile, then read and write with fresh accesses
+    tile->setValue(Z2i::Point(1,1), 11);
+    nbok += (tiledImage(Z2i::Point(1,1)) == 11) ? 1 : 0; nb++;
+    tiledImage.setValue(Z2i::Point(2,2), 22);
+    nbok += (tile->operator()(Z2i::Point(2,2)) == 22) ? 1 : 0; nb++;
+    nbok += (tiledImage.findTileFromBlockCoords(Z2i::Point(0,0)) == tile) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // both values are written back when the tile is unpinned
+    tiledImage.unpinTile(tile);
+    nbok += (tiledImage.getNbPinnedTiles() == 0) ? 1 : 0; nb++;
+    nbok += (image(Z2i::Point(1,1)) == 11 && image(Z2i::Point(2,2)) == 22) ? 1 : 0; nb++;
+    tiledImage(Z2i::Point(5,5));
+    nbok += (tiledImage(Z2i::Point(1,1)) == 11 && tiledImage(Z2i::Point(2,2)) == 22) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // clearing the cache unpins the tiles and writes back the evicted pinned one
+    tile = tiledImage.pinTileFromBlockCoords(Z2i::Point(0,0));
+    tiledImage(Z2i::Point(5,5));
+    tile->setValue(Z2i::Point(3,3), 33);
+    tiledImage.clearCacheAndResetCacheMisses();
+    nbok += (tiledImage.getNbPinnedTiles() == 0) ? 1 : 0; nb++;
+    nbok += (image(Z2i::Point(3,3)) == 33) ? 1 : 0; nb++;
+    nbok += (tiledImage(Z2i::Point(3,3)) == 33) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+/**
+ * Read policy with the nullary 'getPageToDetach' of the original
+ * CImageCacheReadPolicy concept: it keeps the last page and returns it
+ * each time it is asked for the page to detach.
+ */
+template <typename TImageContainer, typename TImageFactory>
+class NullaryReadPolicy
+{
+public:
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+
+    NullaryReadPolicy(TImageFactory & anImageFactory):
+      myPage(NULL), myImageFactory(&anImageFactory)
+    {
+    }
+
+    ImageContainer * getPage(const Point & aPoint)
+    {
+      return (myPage && myPage->domain().isInside(aPoint)) ? myPage : NULL;
+    }
+
+    ImageContainer * getPage(const Domain & aDomain)
+    {
+      return (myPage && myPage->domain().lowerBound() == aDomain.lowerBound()
+              && myPage->domain().upperBound() == aDomain.upperBound()) ? myPage : NULL;
+    }
+
+    ImageContainer * getPageToDetach()
+    {
+      return myPage;
+    }
+
+    void updateCache(const Domain & aDomain)
+    {
+      myPage = myImageFactory->requestImage(aDomain);
+    }
+
+    void clearCache()
+    {
+      myPage = NULL;
+    }
+
+private:
+    ImageContainer * myPage;
+    TImageFactory * myImageFactory;
+};
+
+bool testNullaryReadPolicy()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing a read policy with a nullary getPageToDetach");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(7,7)));
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    typedef NullaryReadPolicy<OutputImage, MyImageFactoryFromImage> MyNullaryReadPolicy;
+    BOOST_CONCEPT_ASSERT(( concepts::CImageCacheReadPolicy< MyNullaryReadPolicy > ));
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyNullaryReadPolicy nullaryReadPolicy(imageFactoryFromImage);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyNullaryReadPolicy, MyImageCacheWritePolicyWT> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, nullaryReadPolicy, imageCacheWritePolicyWT, 2);
+
+    // the page to detach is asked for once per loaded tile
+    nbok += (tiledImage(Z2i::Point(1,1)) == 9) ? 1 : 0; nb++;
+    nbok += (tiledImage(Z2i::Point(6,6)) == 54) ? 1 : 0; nb++;
+    nbok += (tiledImage(Z2i::Point(1,1)) == 9) ? 1 : 0; nb++;
+    nbok += (tiledImage.getCacheMissRead() == 3) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -338,7 +713,7 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d() && testIterators() && test_range_constRange(); // && ... other tests
+    bool res = testSimple() && test3d() && testIterators() && test_range_constRange() && testLRUAndPrefetch() && testLRUByteBudget() && testConcurrentAccess() && testPinnedTileEviction() && testNullaryReadPolicy(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -117,6 +117,9 @@ void testRawReaderOnRef()
   INFO( "Reading file with importRaw" << fileName );
   Image imageRaw = RawReader<Image>::template importRaw< unsigned int >( fileName, extent );
   testImageOnRef( imageRaw );
+
+  INFO( "Mapping file with mapRaw" << fileName );
+  testImageOnRef( RawReader<Image>::template mapRaw< unsigned int >( fileName, extent ) );
 }
 
 /** Compares an image to a generated data.
@@ -173,7 +176,7 @@ void testWriteAndRead( T aSeed )
   RawIO<Image>::write( "export-raw-writer.raw", refImage );
 
   INFO( "Reading image" );
-  Image image = RawIO<Image>::read( "export-raw-writer.raw", upperPt + Point::diagonal(1) );
+  const auto image = RawIO<Image>::read( "export-raw-writer.raw", upperPt + Point::diagonal(1) );
 
   INFO( "Comparing image values" );
   for ( typename Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
@@ -241,6 +244,21 @@ struct RawIO
     }
 };
 
+template < typename Image >
+struct RawIOMapped
+{
+  static inline typename DGtal::RawReader<Image>::template MappedImageContainer< typename Image::Value >
+  read( std::string const& filename, typename Image::Domain::Vector const& extent )
+    {
+      return DGtal::RawReader<Image>::template mapRaw< typename Image::Value>( filename, extent );
+    }
+
+  static inline bool write( std::string const& filename, Image const& anImage )
+    {
+      return DGtal::RawWriter<Image>::template exportRaw< typename Image::Value>( filename, anImage );
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 
 TEST_CASE( "Checking RawReader with reference files in 2D", "[reader][2D][raw][raw32][uint32]" )
@@ -328,3 +346,14 @@ TEST_CASE( "Checking writing & reading double in 3D with generic IO", "[reader][
   testWriteAndRead<3, double, RawIO>( 1.23456789 );
 }
 
+
+// Memory mapped files
+TEST_CASE( "Checking writing & mapping uint16 in 3D with generic IO", "[reader][writer][3D][raw][uint16][mapped]" )
+{
+  testWriteAndRead<3, DGtal::uint16_t, RawIOMapped>( 1 );
+}
+
+TEST_CASE( "Checking writing & mapping double in 2D with generic IO", "[reader][writer][2D][raw][double][mapped]" )
+{
+  testWriteAndRead<2, double, RawIOMapped>( 1.23456789 );
+}
@@ -29,10 +29,12 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/CConstImage.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/io/colormaps/HueShadeColorMap.h"
 #include "DGtal/io/colormaps/GrayscaleColorMap.h"
@@ -166,6 +168,78 @@ bool testConsistence()
   return true;
 }
 
+bool testMapVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing VolReader::mapVol ..." );
+
+  typedef SpaceND<3> Space4Type;
+  typedef HyperRectDomain<Space4Type> TDomain;
+  typedef TDomain::Point Point;
+
+  //Default image selector = STLVector
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  TDomain domain(Point(-3,-2,-1), Point(5,7,11));
+  Image image(domain);
+  unsigned char i = 0;
+  for(Image::Iterator it=image.begin(), itend=image.end(); it != itend; ++it)
+    *it = i++;
+
+  VolWriter<Image>::exportVol("testMapVol.vol", image, false);
+
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< VolReader<Image>::MappedImageContainer > ));
+  VolReader<Image>::MappedImageContainer image2 = VolReader<Image>::mapVol( "testMapVol.vol" );
+  trace.info() << image2 << endl;
+
+  nbok += ( image2.domain().lowerBound() == domain.lowerBound()
+            && image2.domain().upperBound() == domain.upperBound() ) ? 1 : 0;
+  nb++;
+
+  bool allFine = true;
+  for(TDomain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it)
+    allFine = allFine && ( image2( *it ) == image( *it ) );
+  nbok += allFine ? 1 : 0;
+  nb++;
+
+  // compressed files cannot be mapped
+  VolWriter<Image>::exportVol("testMapVol-compressed.vol", image);
+  bool exceptionRaised = false;
+  try
+    {
+      VolReader<Image>::mapVol( "testMapVol-compressed.vol" );
+    }
+  catch(exception& e)
+    {
+      exceptionRaised = true;
+    }
+  nbok += exceptionRaised ? 1 : 0;
+  nb++;
+
+  // invalid header: the exception is raised by the header parsing
+  {
+    std::ofstream out( "testMapVol-invalid.vol" );
+    out << "X: 2\nY: 2\n.\n";
+  }
+  exceptionRaised = false;
+  try
+    {
+      VolReader<Image>::mapVol( "testMapVol-invalid.vol" );
+    }
+  catch(exception& e)
+    {
+      exceptionRaised = true;
+    }
+  nbok += exceptionRaised ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -180,7 +254,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException() && testConsistence(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testConsistence() && testMapVol(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
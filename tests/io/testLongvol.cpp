@@ -73,6 +73,18 @@ bool testLongvol()
       it != itend; ++it, ++ito)
     allFine &= (*it) == (*ito);
       
+  nbok += allFine ? 1 : 0; 
+  nb++;
+
+  LongvolWriter<Image>::exportLongvol("export-longvol-raw.longvol",image,false);
+  LongvolReader<Image>::MappedImageContainer image3 =
+    LongvolReader<Image>::mapLongvol("export-longvol-raw.longvol");
+
+  allFine = ( image3(c) == 0X8899AABBCCDDEEFFull );
+  for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend=image.domain().end();
+      it != itend; ++it)
+    allFine &= image3(*it) == image(*it);
+
   nbok += allFine ? 1 : 0; 
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
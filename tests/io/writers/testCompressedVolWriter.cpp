@@ -29,6 +29,11 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -37,6 +42,8 @@
 #include "DGtal/io/readers/LongvolReader.h"
 #include "DGtal/io/writers/VolWriter.h"
 #include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/VolSliceWriter.h"
+#include "DGtal/io/ChunkedZlib.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 ///////////////////////////////////////////////////////////////////////////////
 using namespace std;
@@ -112,4 +119,196 @@ TEST_CASE( "Testing CompressedLongvol" )
     }
 }
 
+/// Decompresses the voxels of a Version 3 file in one zlib pass,
+/// as done by other Vol readers.
+std::string singleStreamVoxels(const std::string &filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  std::string line;
+  while (std::getline(in, line) && line != ".")
+    ;
+  std::stringstream compressed;
+  compressed << in.rdbuf();
+  std::stringstream voxels;
+  boost::iostreams::filtering_streambuf<boost::iostreams::input> zin;
+  zin.push(boost::iostreams::zlib_decompressor());
+  zin.push(compressed);
+  boost::iostreams::copy(zin, voxels);
+  return voxels.str();
+}
+
+/// Writes and reads back a volume of given depth slice by slice.
+void testSlices(int depth)
+{
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LImage;
+
+  Domain domain(Point(-3,2,1), Point(36,31,depth));
+  Image image(domain);
+  LImage limage(domain);
+  std::string voxels;
+  for(auto p: domain)
+  {
+    image.setValue(p, (unsigned char)((p[0]*7 + p[1]*p[2]) % 256));
+    limage.setValue(p, 0X8899AABBCC000000ull + p[0]*p[1]*p[2]);
+    voxels.push_back((char)image(p));
+  }
+
+  // Streamed slices, chunks of 3 slices compressed by 4 threads
+  {
+    VolSliceWriter<Domain> writer("testslices.vol", domain, true, 3, 4);
+    for(int z = domain.lowerBound()[2]; z <= domain.upperBound()[2]; ++z)
+      writer.writeSlice(image);
+    REQUIRE( writer.nbSlices() == (unsigned int)(depth) );
+    writer.close();
+
+    Image read = VolReader<Image>::importVol("testslices.vol");
+    REQUIRE( read.domain().lowerBound() == domain.lowerBound() );
+    REQUIRE( read.domain().upperBound() == domain.upperBound() );
+    REQUIRE( checkImage(image, read) );
+    REQUIRE( singleStreamVoxels("testslices.vol") == voxels );
+  }
+
+  // Slice values and default chunks
+  {
+    VolSliceWriter<Domain> writer("testslicevalues.vol", domain);
+    const std::size_t sliceSize = 40*30;
+    for(std::size_t z = 0; z < (std::size_t)(depth); ++z)
+      writer.writeSliceValues(voxels.begin() + z*sliceSize);
+    writer.close();
+    REQUIRE( checkImage(image, VolReader<Image>::importVol("testslicevalues.vol")) );
+  }
+
+  // Uncompressed slices
+  {
+    VolSliceWriter<Domain> writer("testslicesraw.vol", domain, false);
+    for(int z = domain.lowerBound()[2]; z <= domain.upperBound()[2]; ++z)
+      writer.writeSlice(image);
+    writer.close();
+    REQUIRE( checkImage(image, VolReader<Image>::importVol("testslicesraw.vol")) );
+  }
+
+  // Longvol slices
+  {
+    VolSliceWriter<Domain, DGtal::uint64_t> writer("testslices.lvol", domain, true, 2, 3);
+    for(int z = domain.lowerBound()[2]; z <= domain.upperBound()[2]; ++z)
+      writer.writeSlice(limage);
+    writer.close();
+    REQUIRE( checkImage(limage, LongvolReader<LImage>::importLongvol("testslices.lvol")) );
+    REQUIRE( singleStreamVoxels("testslices.lvol").size() == 8*domain.size() );
+  }
+}
+
+TEST_CASE( "Testing VolSliceWriter" )
+{
+  SECTION("Depth multiple of the number of slices per chunk")
+  {
+    testSlices(24);
+  }
+
+  SECTION("Depth not multiple of the number of slices per chunk")
+  {
+    testSlices(25);
+  }
+
+  SECTION("Missing slices")
+  {
+    typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+    Domain domain(Point(0,0,0), Point(4,4,4));
+    Image image(domain);
+    VolSliceWriter<Domain> writer("testmissing.vol", domain);
+    writer.writeSlice(image);
+    REQUIRE_THROWS_AS( writer.close(), IOException );
+  }
+}
+
+TEST_CASE( "Testing ChunkedZlib" )
+{
+  std::string data;
+  for (unsigned int i = 0; i < 100000; ++i)
+    data.push_back((char)((i * i) % 251));
+
+  for (std::size_t n : { 0, 1, 4096, 100000 })
+  {
+    std::stringstream out;
+    ChunkedZlibWriter writer(out, 4096, 2);
+    writer.write(data.data(), n/2);
+    writer.write(data.data() + n/2, n - n/2);
+    writer.close();
+    const std::string stream = out.str();
+
+    std::string uncompressed(n, 0);
+    ChunkedZlibReader::decompress(stream.data(), stream.size(), 4096, &uncompressed[0], n, 3);
+    REQUIRE( uncompressed == data.substr(0, n) );
+
+    if (n > 0)
+    {
+      std::string corrupted = stream;
+      corrupted[corrupted.size() / 2] ^= 0x55;
+      REQUIRE_THROWS_AS( ChunkedZlibReader::decompress(corrupted.data(), corrupted.size(), 4096,
+                                                       &uncompressed[0], n), IOException );
+    }
+
+    if (n > 4096)
+    {
+      // Adds 2^63 to the sizes of the first two chunks of the index:
+      // the total size is unchanged modulo 2^64 but the offsets wrap.
+      const std::size_t nb = ChunkedZlibReader::nbChunks(n, 4096);
+      std::string wrapping = stream;
+      wrapping[wrapping.size() - 8 * nb + 7] ^= 0x80;
+      wrapping[wrapping.size() - 8 * nb + 15] ^= 0x80;
+      REQUIRE_THROWS_AS( ChunkedZlibReader::decompress(wrapping.data(), wrapping.size(), 4096,
+                                                       &uncompressed[0], n), IOException );
+    }
+  }
+}
+
+/// Writes a copy of a file with the Chunk-Size header field replaced by
+/// aChunkSize and the last nbRemoved bytes removed.
+void copyVolFile(const std::string &from, const std::string &to,
+                 const std::string &aChunkSize, std::size_t nbRemoved = 0)
+{
+  std::ifstream in(from.c_str(), std::ios::binary);
+  std::stringstream content;
+  content << in.rdbuf();
+  std::string file = content.str();
+  const std::size_t b = file.find("Chunk-Size: ") + 12;
+  file.replace(b, file.find('\n', b) - b, aChunkSize);
+  std::ofstream out(to.c_str(), std::ios::binary);
+  out.write(file.data(), file.size() - nbRemoved);
+}
+
+TEST_CASE( "Testing VolReader with invalid chunked data" )
+{
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  Domain domain(Point(0,0,0), Point(19,19,19));
+  Image image(domain);
+  for(auto p: domain)
+    image.setValue(p, (unsigned char)((p[0]*p[1] + p[2]) % 256));
+  {
+    VolSliceWriter<Domain> writer("testchunks.vol", domain, true, 2);
+    for(int z = 0; z < 20; ++z)
+      writer.writeSlice(image);
+    writer.close();
+  }
+  const std::string chunkSize = std::to_string(2*20*20);
+  copyVolFile("testchunks.vol", "testchunkscopy.vol", chunkSize);
+  REQUIRE( checkImage(image, VolReader<Image>::importVol("testchunkscopy.vol")) );
+
+  SECTION("Truncated data")
+  {
+    copyVolFile("testchunks.vol", "testtruncated.vol", chunkSize, 100);
+    REQUIRE_THROWS_AS( VolReader<Image>::importVol("testtruncated.vol"), IOException );
+  }
+
+  SECTION("Invalid Chunk-Size")
+  {
+    for (std::string c : { "-400", "0", "abc", "99999999999999999999", "1" })
+    {
+      copyVolFile("testchunks.vol", "testchunksize.vol", c);
+      REQUIRE_THROWS_AS( VolReader<Image>::importVol("testchunksize.vol"), IOException );
+    }
+  }
+}
+
 /** @ingroup Tests **/
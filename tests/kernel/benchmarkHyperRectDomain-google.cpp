@@ -39,6 +39,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 
 using namespace DGtal;
 using namespace std;
@@ -68,6 +69,23 @@ struct BenchDomain
   std::vector<Point::Dimension> dimensions;
 };
 
+// Context for the benchmarks on images
+struct BenchImage
+  : public BenchDomain
+{
+  using Image = DGtal::ImageContainerBySTLVector<Domain, unsigned char>;
+
+  BenchImage()
+    : image(domain)
+    {
+      std::size_t i = 0;
+      for (auto& v : image)
+        v = static_cast<unsigned char>((i++ * 7919) % 256);
+    }
+
+  Image image;
+};
+
 
 BENCHMARK_DEFINE_F(BenchDomain, DomainTraversal)(benchmark::State& state)
 {
@@ -122,10 +140,75 @@ BENCHMARK_DEFINE_F(BenchDomain, DomainReverseTraversalSubRange)(benchmark::State
   state.SetItemsProcessed(domain.size() * state.iterations());
 }
 
+BENCHMARK_DEFINE_F(BenchDomain, DomainRowTraversal)(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      Point check;
+      domain.forEachRow([&check] (Point const& origin, Domain::Size length)
+        {
+          Point pt = origin;
+          for (Domain::Size i = 0; i < length; ++i, ++pt[0])
+            check += pt;
+        });
+      benchmark::DoNotOptimize(check);
+    }
+
+  state.SetItemsProcessed(domain.size() * state.iterations());
+}
+
+BENCHMARK_DEFINE_F(BenchImage, ImageThresholdPerPoint)(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      std::size_t count = 0;
+      for (auto const& pt : domain)
+        count += image(pt) > 128 ? 1 : 0;
+      benchmark::DoNotOptimize(count);
+    }
+
+  state.SetItemsProcessed(domain.size() * state.iterations());
+}
+
+BENCHMARK_DEFINE_F(BenchImage, ImageThresholdRows)(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      std::size_t count = 0;
+      image.forEachRow([&count] (Image::ConstIterator row, Image::Size length, Point const&)
+        {
+          for (Image::Size i = 0; i < length; ++i)
+            count += row[i] > 128 ? 1 : 0;
+        });
+      benchmark::DoNotOptimize(count);
+    }
+
+  state.SetItemsProcessed(domain.size() * state.iterations());
+}
+
+BENCHMARK_DEFINE_F(BenchImage, ImageThresholdRowsParallel)(benchmark::State& state)
+{
+  for (auto _ : state)
+    {
+      image.forEachRow([] (Image::Iterator row, Image::Size length, Point const&)
+        {
+          for (Image::Size i = 0; i < length; ++i)
+            row[i] = row[i] > 128 ? 255 : 0;
+        }, 0);
+      benchmark::DoNotOptimize(image.begin());
+    }
+
+  state.SetItemsProcessed(domain.size() * state.iterations());
+}
+
 BENCHMARK_REGISTER_F(BenchDomain, DomainTraversal)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(BenchDomain, DomainReverseTraversal)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(BenchDomain, DomainTraversalSubRange)->Unit(benchmark::kMillisecond);
 BENCHMARK_REGISTER_F(BenchDomain, DomainReverseTraversalSubRange)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchDomain, DomainRowTraversal)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchImage, ImageThresholdPerPoint)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchImage, ImageThresholdRows)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(BenchImage, ImageThresholdRowsParallel)->Unit(benchmark::kMillisecond);
 
 int main(int argc, char* argv[])
 {
@@ -38,6 +38,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
 
@@ -54,10 +55,12 @@ using namespace DGtal;
 typedef DGtal::DigitalSetBySTLSet< Z2i::Domain> FromSet;
 typedef DGtal::DigitalSetBySTLVector< Z2i::Domain> FromVector;
 typedef DGtal::DigitalSetByAssociativeContainer< Z2i::Domain, std::unordered_set<Z2i::Point> > FromUnordered;
+typedef DGtal::DigitalSetByBitset< Z2i::Domain> FromBitset;
 
 typedef DGtal::DigitalSetBySTLSet< Z3i::Domain> FromSet3;
 typedef DGtal::DigitalSetBySTLVector< Z3i::Domain> FromVector3;
 typedef DGtal::DigitalSetByAssociativeContainer< Z3i::Domain, std::unordered_set<Z3i::Point> > FromUnordered3;
+typedef DGtal::DigitalSetByBitset< Z3i::Domain> FromBitset3;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -74,9 +77,11 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitset)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered3)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitset3)->Range(1<<3 , 1 << 8);
 
 
 template<typename Q>
@@ -97,6 +102,7 @@ static void BM_insert(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_insert, FromVector);
 BENCHMARK_TEMPLATE(BM_insert, FromSet);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered);
+BENCHMARK_TEMPLATE(BM_insert, FromBitset);
 BENCHMARK_TEMPLATE(BM_insert, FromVector3);
 BENCHMARK_TEMPLATE(BM_insert, FromSet3);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered3);
@@ -124,11 +130,95 @@ static void BM_iterate(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_iterate, FromVector)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered)->Range(1<<3 , 1 << 10);;
+BENCHMARK_TEMPLATE(BM_iterate, FromBitset)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromVector3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered3)->Range(1<<3 , 1 << 10);;
 
 
+// Dense sets: a ball filling most of a cubic domain of side state.range(0).
+template<typename Q>
+static void fillBall( Q & myset )
+{
+  const typename Q::Point c = ( myset.domain().lowerBound() + myset.domain().upperBound() ) / 2;
+  const double r = 0.45 * ( myset.domain().upperBound()[ 0 ] - myset.domain().lowerBound()[ 0 ] );
+  for ( typename Q::Domain::ConstIterator it = myset.domain().begin(), itend = myset.domain().end();
+        it != itend; ++it )
+    if ( ( *it - c ).norm() <= r )
+      myset.insertNew( *it );
+}
+
+template<typename Q>
+static void BM_denseInsert(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal( (typename Q::Domain::Space::Integer)state.range(0) ) );
+  while (state.KeepRunning())
+    {
+      Q myset( dom );
+      fillBall( myset );
+      benchmark::DoNotOptimize( myset.size() );
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseInsert, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseInsert, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseInsert, FromBitset3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseFind(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal( (typename Q::Domain::Space::Integer)state.range(0) ) );
+  Q myset( dom );
+  fillBall( myset );
+  while (state.KeepRunning())
+    {
+      unsigned int nb = 0;
+      for ( typename Q::Domain::ConstIterator it = dom.begin(), itend = dom.end(); it != itend; ++it )
+        nb += myset( *it ) ? 1 : 0;
+      benchmark::DoNotOptimize( nb );
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseFind, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseFind, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseFind, FromBitset3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseIterate(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal( (typename Q::Domain::Space::Integer)state.range(0) ) );
+  Q myset( dom );
+  fillBall( myset );
+  while (state.KeepRunning())
+    {
+      for(typename Q::ConstIterator it= myset.begin(), itend=myset.end(); it != itend; ++it)
+        benchmark::DoNotOptimize(*it);
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseIterate, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseIterate, FromBitset3)->Range(1<<4 , 1 << 7);
+
+template<typename Q>
+static void BM_denseUnion(benchmark::State& state)
+{
+  typename Q::Domain dom( Q::Point::diagonal(0), Q::Point::diagonal( (typename Q::Domain::Space::Integer)state.range(0) ) );
+  Q ball( dom );
+  fillBall( ball );
+  Q shifted( dom );
+  for(typename Q::ConstIterator it= ball.begin(), itend=ball.end(); it != itend; ++it)
+    if ( dom.isInside( *it + Q::Point::diagonal( 1 ) ) )
+      shifted.insert( *it + Q::Point::diagonal( 1 ) );
+  while (state.KeepRunning())
+    {
+      Q myset( ball );
+      myset += shifted;
+      benchmark::DoNotOptimize( myset.size() );
+    }
+}
+BENCHMARK_TEMPLATE(BM_denseUnion, FromSet3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromUnordered3)->Range(1<<4 , 1 << 7);
+BENCHMARK_TEMPLATE(BM_denseUnion, FromBitset3)->Range(1<<4 , 1 << 7);
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -53,6 +53,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/kernel/sets/DigitalSetInserter.h"
@@ -367,6 +368,83 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetByBitset()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef DigitalSetByBitset< Z3i::Domain > BitSet;
+  typedef std::set< Z3i::Point > STLSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< BitSet > ));
+
+  trace.beginBlock ( "Set operations of DigitalSetByBitset ..." );
+  // 7*9*11 points: the last word of the bitset is partially used.
+  Z3i::Domain domain( Z3i::Point( -3, -4, -5 ), Z3i::Point( 3, 4, 5 ) );
+  BitSet A( domain ), B( domain );
+  STLSet a, b;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 400; ++i )
+    {
+      Z3i::Point p( rand() % 7 - 3, rand() % 9 - 4, rand() % 11 - 5 );
+      Z3i::Point q( rand() % 7 - 3, rand() % 9 - 4, rand() % 11 - 5 );
+      A.insert( p ); a.insert( p );
+      B.insert( q ); b.insert( q );
+    }
+  auto same = [] ( const BitSet & X, const STLSet & x )
+    {
+      STLSet y( X.begin(), X.end() );
+      return X.size() == x.size() && y == x
+        && std::is_sorted( X.begin(), X.end(), [] ( const Z3i::Point & p, const Z3i::Point & q )
+                           { return std::lexicographical_compare( p.rbegin(), p.rend(), q.rbegin(), q.rend() ); } );
+    };
+  INBLOCK_TEST( same( A, a ) && same( B, b ) );
+  INBLOCK_TEST( A( *a.begin() ) && A.find( *a.begin() ) != A.end()
+                && *A.find( *a.begin() ) == *a.begin() );
+  INBLOCK_TEST( ! A( Z3i::Point( 10, 0, 0 ) ) && A.find( Z3i::Point( 10, 0, 0 ) ) == A.end() );
+
+  STLSet x;
+  BitSet U( A ); U += B;
+  std::set_union( a.begin(), a.end(), b.begin(), b.end(), std::inserter( x, x.end() ) );
+  INBLOCK_TEST( same( U, x ) );
+  BitSet I( A ); I &= B; x.clear();
+  std::set_intersection( a.begin(), a.end(), b.begin(), b.end(), std::inserter( x, x.end() ) );
+  INBLOCK_TEST( same( I, x ) );
+  BitSet D( A ); D -= B; x.clear();
+  std::set_difference( a.begin(), a.end(), b.begin(), b.end(), std::inserter( x, x.end() ) );
+  INBLOCK_TEST( same( D, x ) );
+
+  BitSet C( domain );
+  C.assignFromComplement( A );
+  INBLOCK_TEST( C.size() + A.size() == domain.size() );
+  C &= A;
+  INBLOCK_TEST( C.empty() && C.begin() == C.end() );
+
+  // Operations between sets of different domains.
+  BitSet E( Z3i::Domain( Z3i::Point( -1, -1, -1 ), Z3i::Point( 1, 1, 1 ) ) );
+  E.insert( Z3i::Point( 0, 0, 0 ) );
+  E.insert( Z3i::Point( 1, 1, 1 ) );
+  BitSet F( A ); F += E;
+  INBLOCK_TEST( F( Z3i::Point( 0, 0, 0 ) ) && F( Z3i::Point( 1, 1, 1 ) ) );
+  F -= E;
+  INBLOCK_TEST( ! F( Z3i::Point( 0, 0, 0 ) ) && ! F( Z3i::Point( 1, 1, 1 ) ) );
+
+  Z3i::Point lower, upper;
+  E.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Z3i::Point( 0, 0, 0 ) && upper == Z3i::Point( 1, 1, 1 ) );
+  E.erase( E.begin(), E.end() );
+  INBLOCK_TEST( E.empty() );
+
+  // An empty domain gives an empty set without any bit.
+  BitSet G( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( -1, -1, -1 ) ) );
+  INBLOCK_TEST( G.empty() && G.begin() == G.end() && ! G( Z3i::Point( 0, 0, 0 ) ) );
+  BitSet H( A ); H += G; H -= G;
+  INBLOCK_TEST( same( H, a ) );
+  trace.info() << "(" << nbok << "/" << nb << ") " << A << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet<Z2i::DigitalSet> ));
@@ -422,6 +500,11 @@ int main()
   ( DigitalSetByAssociativeContainer<Domain, Container>(domain), DigitalSetByAssociativeContainer<Domain, Container>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitset" );
+  bool okBitset = testDigitalSet< DigitalSetByBitset<Domain> >
+    ( DigitalSetByBitset<Domain>(domain), DigitalSetByBitset<Domain>(domain) );
+  trace.endBlock();
+
   trace.beginBlock( "DigitalSetByUnorderedSet" );
   typedef std::unordered_set<Point> ContainerU;
   bool okUnorderedSet = testDigitalSet< DigitalSetByAssociativeContainer<Domain,ContainerU> >
@@ -440,8 +523,14 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorWholeHBel = testDigitalSetSelector
+      < Domain, WHOLE_DS + HIGH_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Whole set + High belonging test" );
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
+  bool okDigitalSetByBitset = testDigitalSetByBitset();
+
   bool okDigitalSetDraw = testDigitalSetDraw();
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
@@ -449,7 +538,8 @@ int main()
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
-     && okUnorderedSet && okAssoctestSet;
+     && okUnorderedSet && okAssoctestSet
+     && okBitset && okSelectorWholeHBel && okDigitalSetByBitset;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
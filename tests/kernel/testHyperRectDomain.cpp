@@ -406,4 +406,51 @@ TEST_CASE( "Empty domain", "[domain][3D][empty]" )
   REQUIRE( range.rbegin() == range.rend() );
 }
 
+TEST_CASE( "Row traversal", "[domain][3D][rows]" )
+{
+  typedef SpaceND<3> TSpace;
+  typedef TSpace::Point TPoint;
+  typedef HyperRectDomain<TSpace> TDomain;
+
+  const TDomain domain( TPoint( -2, 1, 0 ), TPoint( 4, 3, 5 ) );
+  REQUIRE( domain.rowLength() == 7 );
+  REQUIRE( domain.nbRows() == 3 * 6 );
+  REQUIRE( domain.rowOrigin( 0 ) == domain.lowerBound() );
+  REQUIRE( domain.rowOrigin( 4 ) == TPoint( -2, 2, 1 ) );
+
+  SECTION( "Rows visit the points in the order of the iterators" )
+    {
+      std::vector<TPoint> points;
+      domain.forEachRow( [&points] ( const TPoint & origin, TDomain::Size length )
+        {
+          TPoint p = origin;
+          for ( TDomain::Size i = 0; i < length; ++i, ++p[ 0 ] )
+            points.push_back( p );
+        } );
+      REQUIRE( points.size() == domain.size() );
+      REQUIRE( std::equal( points.begin(), points.end(), domain.begin() ) );
+    }
+
+  SECTION( "Rows visited in parallel" )
+    {
+      std::vector<unsigned int> visits( domain.nbRows(), 0 );
+      domain.forEachRow( [&] ( const TPoint & origin, TDomain::Size length )
+        {
+          REQUIRE( length == domain.rowLength() );
+          const TPoint d = origin - domain.lowerBound();
+          ++visits[ d[ 1 ] + 3 * d[ 2 ] ];
+        }, 4 );
+      REQUIRE( std::count( visits.begin(), visits.end(), 1u ) == (std::ptrdiff_t) visits.size() );
+    }
+
+  SECTION( "Empty domain has no rows" )
+    {
+      const TDomain empty( TPoint::diagonal( 1 ), TPoint::diagonal( 0 ) );
+      REQUIRE( empty.nbRows() == 0 );
+      unsigned int n = 0;
+      empty.forEachRow( [&n] ( const TPoint &, TDomain::Size ) { ++n; } );
+      REQUIRE( n == 0 );
+    }
+}
+
 /** @ingroup Tests **/
@@ -223,6 +223,131 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+/**
+ * ImageHelper functions on images stored in a vector, which read or
+ * write the values row by row.
+ */
+bool testImageHelperRows()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageHelper functions by rows ..." );
+
+  typedef ImageContainerBySTLVector<Domain,int> Image;
+  Domain d( Point(-3,-2), Point(5,4) );
+  Image image( d );
+  //values given row by row
+  Norm1<Point> norm;
+  imageFromFunctor( image, norm );
+  bool ok = true;
+  for ( Domain::ConstIterator it = d.begin(); it != d.end(); ++it )
+    ok = ok && ( image( *it ) == norm( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //all points whose value <= 3, read row by row or point by point
+  DigitalSet aSet(d), aSetRef(d);
+  DigitalSetInserter<DigitalSet> inserter(aSet), inserterRef(aSetRef);
+  setFromImage( image, inserter, 3 );
+  setFromPointsRangeAndFunctor( d.begin(), d.end(), inserterRef, image, 3 );
+  nbok += ( aSet.size() == aSetRef.size() && aSet.size() == 24
+            && std::equal( aSet.begin(), aSet.end(), aSetRef.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //all points whose value is between 2 and 4
+  DigitalSet aSet2(d);
+  DigitalSetInserter<DigitalSet> inserter2(aSet2);
+  setFromImage( image, inserter2, 2, 4 );
+  ok = true;
+  for ( Domain::ConstIterator it = d.begin(); it != d.end(); ++it )
+    ok = ok && ( aSet2( *it ) == ( image( *it ) >= 2 && image( *it ) <= 4 ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //rows of a bool image written with several threads (visited sequentially)
+  typedef ImageContainerBySTLVector<Domain,bool> BoolImage;
+  BoolImage bimage( d );
+  bimage.forEachRow( [&] ( BoolImage::Iterator row, BoolImage::Domain::Size length, const Point & origin )
+    {
+      for ( BoolImage::Domain::Size i = 0; i < length; ++i )
+        row[ i ] = image( origin + Point( (int)i, 0 ) ) <= 3;
+    }, 0 );
+  ok = true;
+  for ( Domain::ConstIterator it = d.begin(); it != d.end(); ++it )
+    ok = ok && ( bimage( *it ) == aSet( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Parallel SetFromImage and ImageFromSet should give the same results
+ * as the sequential ones.
+ */
+bool testParallelConversions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing parallel SetFromImage and ImageFromSet ..." );
+
+  typedef ImageContainerBySTLVector<Domain,int> Image;
+  typedef DigitalSetBySTLVector<Domain> VectorSet;
+  Domain d( Point(-20,-13), Point(31,40) );
+  Image image( d );
+  Norm1<Point> norm;
+  imageFromFunctor( image, norm );
+
+  //points whose value is in ]10,30]
+  DigitalSet aSet(d), aSetRef(d);
+  SetFromImage<DigitalSet>::append<Image>( aSetRef, image, 10, 30 );
+  SetFromImage<DigitalSet>::appendParallel<Image>( aSet, image, 10, 30, 4 );
+  bool ok = aSet.size() == aSetRef.size();
+  for ( DigitalSet::ConstIterator it = aSetRef.begin(); it != aSetRef.end(); ++it )
+    ok = ok && aSet( *it );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") unordered set" << std::endl;
+
+  //the vector set is in the order of the domain
+  VectorSet vSet(d), vSetRef(d);
+  SetFromImage<VectorSet>::append<Image>( vSetRef, image, 10, 30 );
+  SetFromImage<VectorSet>::appendParallel<Image>( vSet, image, 10, 30, 4 );
+  nbok += ( vSet.size() == vSetRef.size()
+            && std::equal( vSet.begin(), vSet.end(), vSetRef.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") vector set" << std::endl;
+
+  //appending to a non empty vector set does not duplicate points
+  SetFromImage<VectorSet>::appendParallel<Image>( vSet, image, 0, 20, 4 );
+  VectorSet vSetRef2( vSetRef );
+  SetFromImage<VectorSet>::append<Image>( vSetRef2, image, 0, 20 );
+  nbok += ( vSet.size() == vSetRef2.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") non empty vector set" << std::endl;
+
+  //set back to image, from both kinds of sets
+  Image image2( d ), image3( d ), imageRef( d );
+  ImageFromSet<Image>::append<DigitalSet>( imageRef, aSetRef, 7 );
+  ImageFromSet<Image>::appendParallel( image2, aSet, 7, 4 );
+  ImageFromSet<Image>::appendParallel( image3, vSetRef, 7, 4 );
+  Image::ConstRange r = imageRef.constRange();
+  nbok += ( std::equal( r.begin(), r.end(), image2.constRange().begin() )
+            && std::equal( r.begin(), r.end(), image3.constRange().begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") images" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -234,7 +359,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage() && testImageHelperRows()
+    && testParallelConversions();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
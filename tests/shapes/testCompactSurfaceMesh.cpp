@@ -0,0 +1,246 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompactSurfaceMesh.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class CompactSurfaceMesh.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/CompactSurfaceMesh.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3,double>                       RealPoint;
+typedef PointVector<3,double>                       RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >        PolygonMesh;
+typedef CompactSurfaceMesh< RealPoint, RealVector > CompactMesh;
+typedef SurfaceMeshHelper< RealPoint, RealVector >  PolygonMeshHelper;
+typedef PolygonMesh::Vertices                       Vertices;
+
+/// A box with an open side and a quadrangle on top of one side.
+PolygonMesh makeBox()
+{
+  std::vector< RealPoint > positions =
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 }, { 0, 0, 1 },
+      { 1, 0, 1 }, { 0, 1, 1 }, { 1, 1, 1 }, { 1, 0, 2 }, { 0, 0, 2 } };
+  std::vector< Vertices > faces =
+    { { 1, 0, 2, 3 }, { 0, 1, 5, 4 }, { 1, 3, 7, 5 },
+      { 3, 2, 6, 7 }, { 2, 0, 4, 6 }, { 4, 5, 8, 9 } };
+  return PolygonMesh( positions.cbegin(), positions.cend(),
+                      faces.cbegin(), faces.cend() );
+}
+
+/// Three triangles sharing an edge.
+PolygonMesh makeNonManifoldBoundary()
+{
+  std::vector< RealPoint > positions =
+    { { 0, 0, 1 }, { 0, -1, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 0 } };
+  std::vector< Vertices > faces = { { 0, 4, 1 }, { 0, 4, 2 }, { 0, 4, 3 } };
+  return PolygonMesh( positions.cbegin(), positions.cend(),
+                      faces.cbegin(), faces.cend() );
+}
+
+/// @return the values of a range as a vector.
+template <typename Range>
+std::vector< std::size_t > toVector( const Range& r )
+{
+  return std::vector< std::size_t >( r.begin(), r.end() );
+}
+
+/// @return 'true' iff the compact mesh has the same elements and the
+/// same incidence relations as the surface mesh.
+bool isSame( const PolygonMesh& smesh, const CompactMesh& cmesh )
+{
+  bool ok = smesh.nbVertices() == cmesh.nbVertices()
+    && smesh.nbEdges() == cmesh.nbEdges()
+    && smesh.nbFaces() == cmesh.nbFaces()
+    && smesh.Euler()   == cmesh.Euler();
+  if ( ! ok ) return false;
+  for ( std::size_t v = 0; v < smesh.nbVertices(); ++v )
+    {
+      ok = ok && smesh.incidentFaces( v )    == toVector( cmesh.incidentFaces( v ) );
+      ok = ok && smesh.neighborVertices( v ) == toVector( cmesh.neighborVertices( v ) );
+      ok = ok && smesh.degree( v )           == cmesh.degree( v );
+      for ( auto w : smesh.neighborVertices( v ) )
+        ok = ok && smesh.makeEdge( v, w ) == cmesh.makeEdge( w, v );
+      ok = ok && cmesh.makeEdge( v, v ) == cmesh.nbEdges();
+    }
+  for ( std::size_t f = 0; f < smesh.nbFaces(); ++f )
+    {
+      ok = ok && smesh.incidentVertices( f ) == toVector( cmesh.incidentVertices( f ) );
+      ok = ok && smesh.neighborFaces( f )    == toVector( cmesh.neighborFaces( f ) );
+      ok = ok && ( smesh.faceCentroid( f ) - cmesh.faceCentroid( f ) ).norm() < 1e-12;
+      ok = ok && std::abs( smesh.faceArea( f ) - cmesh.faceArea( f ) ) < 1e-12;
+    }
+  for ( std::size_t e = 0; e < smesh.nbEdges(); ++e )
+    {
+      ok = ok && smesh.edgeVertices( e )   == cmesh.edgeVertices( e );
+      ok = ok && smesh.edgeFaces( e )      == toVector( cmesh.edgeFaces( e ) );
+      ok = ok && smesh.edgeRightFaces( e ) == toVector( cmesh.edgeRightFaces( e ) );
+      ok = ok && smesh.edgeLeftFaces( e )  == toVector( cmesh.edgeLeftFaces( e ) );
+    }
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompactSurfaceMesh.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "CompactSurfaceMesh< RealPoint3 > concept check tests", "[compactmesh][concepts]" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CUndirectedSimpleGraph< CompactMesh > ));
+}
+
+SCENARIO( "CompactSurfaceMesh< RealPoint3 > build tests", "[compactmesh][build]" )
+{
+  GIVEN( "A box with an open side" ) {
+    PolygonMesh smesh = makeBox();
+    CompactMesh cmesh( smesh );
+    THEN( "The compact mesh has the same incidence relations as the surface mesh" ) {
+      REQUIRE( cmesh.isValid() );
+      REQUIRE( cmesh.nbVertices() == 10 );
+      REQUIRE( cmesh.nbFaces()    == 6 );
+      REQUIRE( isSame( smesh, cmesh ) );
+    }
+    THEN( "The face along (1,3) is a quadrangle (1,3,7,5)" ) {
+      const auto e13 = cmesh.makeEdge( 1, 3 );
+      const auto lf  = cmesh.edgeLeftFaces( e13 );
+      REQUIRE( lf.size() == 1 );
+      REQUIRE( toVector( cmesh.incidentVertices( lf[ 0 ] ) ) == Vertices{ 1, 3, 7, 5 } );
+    }
+    THEN( "Edges that do not exist are not found" ) {
+      REQUIRE( cmesh.makeEdge( 0, 7 ) == cmesh.nbEdges() );
+      REQUIRE( cmesh.makeEdge( 8, 2 ) == cmesh.nbEdges() );
+    }
+    THEN( "Converting back gives the same surface mesh" ) {
+      REQUIRE( isSame( cmesh.toSurfaceMesh(), cmesh ) );
+    }
+  }
+  GIVEN( "Three triangles sharing an edge" ) {
+    PolygonMesh smesh = makeNonManifoldBoundary();
+    CompactMesh cmesh( smesh );
+    THEN( "The compact mesh has the same incidence relations as the surface mesh" ) {
+      REQUIRE( isSame( smesh, cmesh ) );
+      REQUIRE( cmesh.edgeFaces( cmesh.makeEdge( 0, 4 ) ).size() == 3 );
+    }
+  }
+  GIVEN( "A sphere, a torus and a lantern" ) {
+    auto sphere  = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero, 10, 10,
+                                                  PolygonMeshHelper::NormalsType::VERTEX_NORMALS );
+    auto torus   = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero, 10, 10, 0,
+                                                 PolygonMeshHelper::NormalsType::FACE_NORMALS );
+    auto lantern = PolygonMeshHelper::makeLantern( 3.0, 3.0, RealPoint::zero, 10, 10,
+                                                   PolygonMeshHelper::NormalsType::NO_NORMALS );
+    THEN( "The compact meshes have the same incidence relations as the surface meshes" ) {
+      CompactMesh csphere( sphere ), ctorus( torus, 1 ), clantern( lantern );
+      REQUIRE( isSame( sphere,  csphere ) );
+      REQUIRE( isSame( torus,   ctorus ) );
+      REQUIRE( isSame( lantern, clantern ) );
+      REQUIRE( csphere.vertexNormals() == sphere.vertexNormals() );
+      REQUIRE( ctorus.faceNormals()    == torus.faceNormals() );
+    }
+  }
+}
+
+SCENARIO( "CompactSurfaceMesh< RealPoint3 > renumbering tests", "[compactmesh][renumber]" )
+{
+  auto sphere = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero, 20, 20,
+                                               PolygonMeshHelper::NormalsType::VERTEX_NORMALS );
+  CompactMesh cmesh( sphere );
+  auto orders = cmesh.reorderAlongSpaceFillingCurve();
+  const auto& vertexOrder = orders.first;
+  const auto& faceOrder   = orders.second;
+  GIVEN( "A sphere renumbered along a space filling curve" ) {
+    THEN( "The orders are permutations" ) {
+      auto sv = vertexOrder, sf = faceOrder;
+      std::sort( sv.begin(), sv.end() );
+      std::sort( sf.begin(), sf.end() );
+      REQUIRE( sv.size() == sphere.nbVertices() );
+      REQUIRE( sf.size() == sphere.nbFaces() );
+      for ( std::size_t i = 0; i < sv.size(); ++i ) REQUIRE( sv[ i ] == i );
+      for ( std::size_t i = 0; i < sf.size(); ++i ) REQUIRE( sf[ i ] == i );
+    }
+    THEN( "Positions, normals and faces follow the renumbering" ) {
+      std::vector< std::size_t > newIndex( vertexOrder.size() );
+      for ( std::size_t v = 0; v < vertexOrder.size(); ++v ) newIndex[ vertexOrder[ v ] ] = v;
+      bool ok = true;
+      for ( std::size_t v = 0; v < cmesh.nbVertices(); ++v )
+        {
+          ok = ok && cmesh.position( v ) == sphere.position( vertexOrder[ v ] );
+          ok = ok && cmesh.vertexNormals()[ v ] == sphere.vertexNormal( vertexOrder[ v ] );
+        }
+      for ( std::size_t f = 0; f < cmesh.nbFaces(); ++f )
+        {
+          Vertices vtcs;
+          for ( auto v : sphere.incidentVertices( faceOrder[ f ] ) )
+            vtcs.push_back( newIndex[ v ] );
+          ok = ok && vtcs == toVector( cmesh.incidentVertices( f ) );
+        }
+      REQUIRE( ok );
+    }
+    THEN( "The incidence relations are rebuilt" ) {
+      REQUIRE( cmesh.Euler() == 2 );
+      REQUIRE( isSame( cmesh.toSurfaceMesh(), cmesh ) );
+    }
+    THEN( "Neighbor vertices have closer indices than in a random numbering" ) {
+      // Mean difference of the indices of the two vertices of the edges.
+      auto spread = [] ( const CompactMesh& m )
+        {
+          double d = 0.0;
+          for ( auto e : m.allEdgeVertices() ) d += double( e.second - e.first );
+          return d / m.nbEdges();
+        };
+      CompactMesh shuffled( sphere );
+      std::vector< std::size_t > vrand( shuffled.nbVertices() ), frand( shuffled.nbFaces() );
+      for ( std::size_t i = 0; i < vrand.size(); ++i ) vrand[ i ] = i;
+      for ( std::size_t i = 0; i < frand.size(); ++i ) frand[ i ] = i;
+      std::mt19937 gen( 0 );
+      std::shuffle( vrand.begin(), vrand.end(), gen );
+      std::shuffle( frand.begin(), frand.end(), gen );
+      shuffled.renumber( vrand, frand );
+      REQUIRE( shuffled.Euler() == 2 );
+      const double d_random = spread( shuffled );
+      shuffled.reorderAlongSpaceFillingCurve();
+      REQUIRE( isSame( shuffled.toSurfaceMesh(), shuffled ) );
+      REQUIRE( spread( shuffled ) < 0.5 * d_random );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
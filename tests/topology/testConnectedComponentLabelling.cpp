@@ -0,0 +1,201 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing class ConnectedComponentLabelling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that the labelling of a random set gives the components of
+ * Object::writeComponents, whatever the number of threads.
+ */
+template <typename TCCL, typename TObject>
+void checkComponents( const typename TCCL::Domain & domain,
+                      const typename TObject::DigitalTopology & topology,
+                      double density, unsigned int seed )
+{
+  typedef typename TCCL::Domain Domain;
+  typedef typename TCCL::Point Point;
+  typedef typename TObject::DigitalSet DigitalSet;
+
+  std::mt19937 gen( seed );
+  std::bernoulli_distribution inside( density );
+  ImageContainerBySTLVector<Domain, unsigned char> image( domain );
+  DigitalSet set( domain );
+  for ( auto p : domain )
+    if ( inside( gen ) )
+      {
+        image.setValue( p, 255 );
+        set.insertNew( p );
+      }
+
+  TCCL ccl;
+  const auto nb = ccl.compute( image, (unsigned char) 0, 1 );
+  REQUIRE( ccl.isValid() );
+
+  std::vector<TObject> objects;
+  std::back_insert_iterator< std::vector<TObject> > inserter( objects );
+  const auto nbRef = TObject( topology, set ).writeComponents( inserter );
+  REQUIRE( nb == nbRef );
+  REQUIRE( ccl.sizes()[ 0 ] == domain.size() - set.size() );
+
+  // each component is a component of writeComponents
+  for ( const TObject & obj : objects )
+    {
+      const Point p = *obj.pointSet().begin();
+      const auto l = ccl.labels()( p );
+      REQUIRE( l != 0 );
+      REQUIRE( ccl.sizes()[ l ] == obj.size() );
+      unsigned int nbSame = 0;
+      for ( const Point & q : obj.pointSet() )
+        nbSame += ccl.labels()( q ) == l ? 1 : 0;
+      REQUIRE( nbSame == obj.size() );
+    }
+
+  // labels are numbered by first point, whatever the number of threads
+  typename Domain::Size previous = 0;
+  for ( typename TCCL::Label l = 1; l <= nb; ++l )
+    {
+      const Point p = ccl.representative( l );
+      REQUIRE( ccl.labels()( p ) == l );
+      const auto index = Linearizer<Domain, ColMajorStorage>::getIndex( p, domain );
+      REQUIRE( ( l == 1 || index > previous ) );
+      previous = index;
+    }
+  TCCL cclParallel;
+  cclParallel.compute( image, (unsigned char) 0, 4 );
+  REQUIRE( cclParallel.nbComponents() == nb );
+  REQUIRE( std::equal( ccl.labels().begin(), ccl.labels().end(),
+                       cclParallel.labels().begin() ) );
+}
+
+TEST_CASE( "Testing ConnectedComponentLabelling in 2D" )
+{
+  using namespace Z2i;
+  const Domain domain( Point( -7, -3 ), Point( 30, 25 ) );
+
+  SECTION( "4-adjacency" )
+    {
+      checkComponents< ConnectedComponentLabelling<Space, 1>, Object4_8 >( domain, dt4_8, 0.5, 1 );
+    }
+  SECTION( "8-adjacency" )
+    {
+      checkComponents< ConnectedComponentLabelling<Space, 2>, Object8_4 >( domain, dt8_4, 0.4, 2 );
+    }
+}
+
+TEST_CASE( "Testing ConnectedComponentLabelling in 3D" )
+{
+  using namespace Z3i;
+  const Domain domain( Point( -3, 0, -5 ), Point( 12, 10, 17 ) );
+
+  SECTION( "6-adjacency" )
+    {
+      checkComponents< ConnectedComponentLabelling<Space, 1>, Object6_18 >( domain, dt6_18, 0.3, 3 );
+    }
+  SECTION( "18-adjacency" )
+    {
+      checkComponents< ConnectedComponentLabelling<Space, 2>, Object18_6 >( domain, dt18_6, 0.2, 4 );
+    }
+  SECTION( "26-adjacency" )
+    {
+      checkComponents< ConnectedComponentLabelling<Space, 3>, Object26_6 >( domain, dt26_6, 0.15, 5 );
+    }
+}
+
+TEST_CASE( "Testing ConnectedComponentLabelling inputs" )
+{
+  using namespace Z3i;
+  typedef ConnectedComponentLabelling<Space, 1> CCL;
+  const Domain domain( Point( 0, 0, 0 ), Point( 9, 9, 9 ) );
+
+  // two slabs joined by a bar crossing all the slices
+  DigitalSetByBitset<Domain> set( domain );
+  for ( auto p : domain )
+    if ( p[ 0 ] == 1 || p[ 0 ] == 8 || ( p[ 1 ] == 5 && p[ 2 ] == 5 ) || p[ 0 ] == 4 )
+      set.insert( p );
+  CCL ccl;
+
+  SECTION( "Bitset and predicate" )
+    {
+      REQUIRE( ccl.compute( set, 3 ) == 1 );
+      REQUIRE( ccl.sizes()[ 1 ] == set.size() );
+      REQUIRE( ccl.compute( domain, set, 3 ) == 1 );
+      REQUIRE( ccl.representative( 1 ) == Point( 1, 0, 0 ) );
+    }
+
+  SECTION( "Without the bar" )
+    {
+      for ( auto p : domain )
+        if ( p[ 1 ] == 5 && p[ 2 ] == 5 && p[ 0 ] != 1 && p[ 0 ] != 4 && p[ 0 ] != 8 )
+          set.erase( p );
+      REQUIRE( ccl.compute( set, 5 ) == 3 );
+      REQUIRE( ccl.sizes()[ 1 ] == 100 );
+      REQUIRE( ccl.labels()( Point( 4, 2, 7 ) ) == 2 );
+      REQUIRE( ccl.labels()( Point( 8, 9, 9 ) ) == 3 );
+    }
+
+  SECTION( "Empty domain" )
+    {
+      REQUIRE( ccl.compute( Domain(), set ) == 0 );
+      REQUIRE( ccl.nbComponents() == 0 );
+    }
+
+  SECTION( "Image of unsigned char" )
+    {
+      ImageContainerBySTLVector<Domain, unsigned char> image( domain );
+      for ( auto p : set )
+        image.setValue( p, 255 );
+      REQUIRE( ccl.compute( image, 0 ) == 1 );
+      REQUIRE( ccl.sizes()[ 1 ] == set.size() );
+    }
+
+  SECTION( "Labels too small for the domain" )
+    {
+      ConnectedComponentLabelling<Space, 1, DGtal::uint8_t> ccl8;
+      REQUIRE_THROWS_AS( ccl8.compute( set ), std::overflow_error );
+      REQUIRE( ccl8.compute( Domain( Point( 0, 0, 0 ), Point( 4, 4, 4 ) ), set ) == 2 );
+    }
+}
+
+/** @ingroup Tests **/
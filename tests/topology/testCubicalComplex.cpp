@@ -36,6 +36,7 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/base/FlatMap.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -618,5 +619,169 @@ SCENARIO( "CubicalComplex< K2,std::map<> > set operations and relations", "[cubi
   bool X1bd_equal_X1boundary = X1bd == X1.boundary();
   REQUIRE( X1bd_equal_X1boundary );
 }
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// FLATMAP
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "CubicalComplex< K3,FlatMap<> > has the same cells as CubicalComplex< K3,std::map<> >", "[cubical_complex][flat_map]" )
+{
+  typedef KhalimskySpaceND<3>               KSpace;
+  typedef KSpace::Point                     Point;
+  typedef KSpace::Cell                      Cell;
+  typedef std::map<Cell, CubicalCellData>   Map;
+  typedef FlatMap<Cell, CubicalCellData>    FMap;
+  typedef CubicalComplex< KSpace, Map >     CC;
+  typedef CubicalComplex< KSpace, FMap >    FCC;
+
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 512,512,512 ), true );
+  auto sameCells = [] ( const CC& X, const FCC& Y )
+    {
+      if ( X.size() != Y.size() ) return false;
+      for ( auto it = X.begin(), itE = X.end(); it != itE; ++it )
+        if ( ! Y.belongs( *it ) ) return false;
+      return true;
+    };
+
+  GIVEN( "Two cubical complexes with the same random 3-cells" ) {
+    CC  X( K );
+    FCC Y( K );
+    std::vector<Cell> cells;
+    for ( int n = 0; n < NBCELLS; ++n )
+      {
+        Point p( (rand() % 64) | 0x1, (rand() % 64) | 0x1, (rand() % 64) | 0x1 );
+        cells.push_back( K.uCell( p ) );
+        X.insertCell( cells.back() );
+      }
+    Y.insertCells( cells.begin(), cells.end() );
+    REQUIRE( sameCells( X, Y ) );
+
+    WHEN( "Closing them" ) {
+      X.close();
+      Y.close();
+      THEN( "They have the same cells" ) {
+        REQUIRE( sameCells( X, Y ) );
+        REQUIRE( X.euler() == Y.euler() );
+      } AND_THEN( "They have the same boundary, interior, and opening" ) {
+        REQUIRE( sameCells( X.boundary( true ), Y.boundary( true ) ) );
+        REQUIRE( sameCells( X.interior(), Y.interior() ) );
+        CC  XI( K ), XB( K );
+        FCC YI( K ), YB( K );
+        X.getInteriorAndBoundary( XI, XB, true );
+        Y.getInteriorAndBoundary( YI, YB, true );
+        REQUIRE( sameCells( XI, YI ) );
+        REQUIRE( sameCells( XB, YB ) );
+        REQUIRE( sameCells( *X, *Y ) );
+      }
+    }
+
+    WHEN( "Computing the closure and the star of some of their cells" ) {
+      X.close();
+      Y.close();
+      CC  SX( K );
+      FCC SY( K );
+      for ( int n = 0; n < 100; ++n )
+        {
+          Cell c = K.uPointel( Point( 2*( rand() % 32 ), 2*( rand() % 32 ), 2*( rand() % 32 ) ) );
+          SX.insert( c );
+          SY.insert( c );
+        }
+      THEN( "They are the same" ) {
+        REQUIRE( sameCells( X.closure( X.star( SX ) ), Y.closure( Y.star( SY ) ) ) );
+        REQUIRE( sameCells( X.link( SX ), Y.link( SY ) ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "CubicalComplex< K3,FlatMap<> > collapse tests", "[cubical_complex][collapse][flat_map]" )
+{
+  typedef KhalimskySpaceND<3>                     KSpace;
+  typedef KSpace::Point                           Point;
+  typedef KSpace::Cell                            Cell;
+  typedef KSpace::Integer                         Integer;
+  typedef FlatMap<Cell, CubicalCellData>          Map;
+  typedef CubicalComplex< KSpace, Map >           CC;
+  typedef CC::CellMapIterator                     CellMapIterator;
+
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 512,512,512 ), true );
+
+  GIVEN( "A closed cubical complex made of 3x3x3 voxels with their incident cells" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 3; ++x )
+      for ( Integer y = 0; y < 3; ++y )
+        for ( Integer z = 0; z < 3; ++z )
+          S.push_back( K.uSpel( Point( x, y, z ) ) );
+    complex.insertCells( S.begin(), S.end() );
+    complex.close();
+
+    THEN( "It has Euler characteristic 1" ) {
+      REQUIRE( complex.euler() == 1 );
+    }
+
+    WHEN( "Fixing two vertices of this big cube and collapsing it" ) {
+      CellMapIterator it1 = complex.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) );
+      CellMapIterator it2 = complex.findCell( 0, K.uCell( Point( 4, 4, 4 ) ) );
+      REQUIRE( it1 != complex.end( 0 ) );
+      REQUIRE( it2 != complex.end( 0 ) );
+      it1->second.data |= CC::FIXED;
+      it2->second.data |= CC::FIXED;
+      CC::DefaultCellMapIteratorPriority P;
+      functions::collapse( complex, S.begin(), S.end(), P, false, true );
+
+      THEN( "It keeps its topology so its euler characteristic is 1" ) {
+       REQUIRE( complex.euler() == 1 );
+      } AND_THEN( "It has no more 2-cells and 3-cells" ) {
+        REQUIRE( complex.nbCells( 2 ) == 0 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+      }
+    }
+  }
+}
+
+SCENARIO( "CubicalComplex< K2,FlatMap<> > set operations and relations", "[cubical_complex][ccops][flat_map]" )
+{
+  typedef KhalimskySpaceND<2>               KSpace;
+  typedef KSpace::Point                     Point;
+  typedef KSpace::Cell                      Cell;
+  typedef FlatMap<Cell, CubicalCellData>    Map;
+  typedef CubicalComplex< KSpace, Map >     CC;
+
+  KSpace K;
+  K.init( Point( 0,0 ), Point( 5,3 ), true );
+  CC X1( K );
+  X1.insertCell( K.uSpel( Point(1,1) ) );
+  X1.insertCell( K.uSpel( Point(2,1) ) );
+  X1.insertCell( K.uSpel( Point(3,1) ) );
+  X1.insertCell( K.uSpel( Point(2,2) ) );
+  CC X1c = ~ X1;
+
+  CC X2( K );
+  X2.insertCell( K.uSpel( Point(2,2) ) );
+  X2.insertCell( K.uSpel( Point(3,2) ) );
+  X2.insertCell( K.uSpel( Point(4,2) ) );
+  X2.close();
+  CC X2c = ~ X2;
+  REQUIRE( ( X1 & X2 ).size() < X1.size() );
+  bool X1_and_X2_included_in_X1 = ( X1 & X2 ) <= X1;
+  bool X1c_and_X2c_included_in_X1c = ( X1c & X2c ) <= X1c;
+  CC A = ~( X1 & X2 );
+  CC B = ~( *(X1c & X2c) );
+  bool cl_X1_and_X2_equal_to_X1c_and_X2c = A == B;
+
+  REQUIRE( X1_and_X2_included_in_X1 );
+  REQUIRE( X1c_and_X2c_included_in_X1c );
+  REQUIRE( cl_X1_and_X2_equal_to_X1c_and_X2c );
+
+  CC X1bd = X1c - *X1c;
+  bool X1bd_equal_X1boundary = X1bd == X1.boundary();
+  REQUIRE( X1bd_equal_X1boundary );
+  REQUIRE( ( X1c | X2c ).size() == ( X1c.size() + X2c.size() - ( X1c & X2c ).size() ) );
+}
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -48,18 +48,20 @@ namespace DGtal {
   bool
   testImplicitDigitalSurface( const KSpace & K, 
                               const PointPredicate & pp,
-                              const typename KSpace::Surfel & bel )
+                              const typename KSpace::Surfel & bel,
+                              bool bitmaps )
   {
     typedef ImplicitDigitalSurface<KSpace,PointPredicate> Boundary;
     typedef typename Boundary::SurfelConstIterator ConstIterator;
     
     unsigned int nbok = 0;
     unsigned int nb = 0;
-    trace.beginBlock ( "Testing block ... ImplicitDigitalSurface" );
+    trace.beginBlock ( std::string( "Testing block ... ImplicitDigitalSurface" )
+                       + ( bitmaps ? " (bitmaps)" : " (set)" ) );
     trace.beginBlock ( "ImplicitDigitalSurface instanciation" );
     Boundary boundary( K, pp,
                        SurfelAdjacency<KSpace::dimension>( true ), bel,
-                       true );
+                       true, bitmaps );
     trace.endBlock();
     trace.beginBlock ( "Counting the number of surfels (breadth first traversal)" );
     unsigned int nbsurfels = 0;
@@ -116,7 +118,9 @@ int main( int , char** )
       Surfel bel = Surfaces<KSpace>::findABel( K, ellipse, 10000 );
       res = 
         testImplicitDigitalSurface<KSpace, ImplicitDigitalEllipse>
-        ( K, ellipse, bel );
+        ( K, ellipse, bel, false )
+        && testImplicitDigitalSurface<KSpace, ImplicitDigitalEllipse>
+        ( K, ellipse, bel, true );
     }
   else
     res = false;
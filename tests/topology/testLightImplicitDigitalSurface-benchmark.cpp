@@ -33,6 +33,7 @@
 #include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/topology/DigitalSetBoundary.h"
 #include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/graph/BreadthFirstVisitor.h"
 #include "DGtal/shapes/Shapes.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -72,6 +73,15 @@ namespace DGtal {
     trace.info() << "(" << nbok << "/" << nb << ") "
                    << "nbsurfels == 354382" << std::endl;
     trace.endBlock();
+    trace.beginBlock ( "Counting the number of surfels (tracking with bitmaps)" );
+    std::vector< typename KSpace::SCell > surfels;
+    Surfaces<KSpace>::trackBoundaryWithBitmaps
+      ( surfels, K, SurfelAdjacency<KSpace::dimension>( true ), pp, bel );
+    trace.info() << surfels.size() << " surfels found." << std::endl;
+    nb++; nbok += surfels.size() == 354382 ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "nbsurfels == 354382" << std::endl;
+    trace.endBlock();
     trace.endBlock();
     return nbok == nb;
   }
@@ -30,11 +30,13 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <random>
 #include "DGtalCatch.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 #include "DGtal/topology/tables/NeighborhoodTables.h"
 using namespace std;
 using namespace DGtal;
@@ -298,6 +300,81 @@ TEST_CASE_METHOD(Objects2D, "Simplicity tables match on-the-fly calculations for
   }
 }
 
+template <typename TDomain, typename TDigitalSet>
+void randomSets( const TDomain & domain, TDigitalSet & set,
+                 DigitalSetByBitset<TDomain> & bitset, double density )
+{
+  std::mt19937 gen( 7 );
+  std::bernoulli_distribution inside( density );
+  for ( const auto & p : domain )
+    if ( inside( gen ) )
+      {
+        set.insertNew( p );
+        bitset.insert( p );
+      }
+}
+
+TEST_CASE( "Configurations read in a bitset match the ones of an Object", "[bitset][configuration]" )
+{
+  SECTION( "2D" )
+    {
+      using namespace Z2i;
+      auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+      // rows of 67 points, so that rows cross words
+      const Domain domain( Point( -3, -2 ), Point( 63, 9 ) );
+      DigitalSet set( domain );
+      DigitalSetByBitset<Domain> bitset( domain );
+      randomSets( domain, set, bitset, 0.5 );
+      const Object8_4 obj( dt8_4, set );
+      for ( const auto & p : domain )
+        {
+          INFO( "Point: " << p );
+          CHECK( getNeighborhoodConfigurationOccupancy( bitset, p )
+                 == obj.getNeighborhoodConfigurationOccupancy( p, *mapZeroNeighborhoodToMask ) );
+        }
+    }
+
+  SECTION( "3D" )
+    {
+      using namespace Z3i;
+      auto mapZeroNeighborhoodToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+      const Domain domain( Point( -3, -2, 0 ), Point( 63, 5, 4 ) );
+      DigitalSet set( domain );
+      DigitalSetByBitset<Domain> bitset( domain );
+      randomSets( domain, set, bitset, 0.5 );
+      const Object26_6 obj( dt26_6, set );
+      for ( const auto & p : domain )
+        {
+          INFO( "Point: " << p );
+          CHECK( getNeighborhoodConfigurationOccupancy( bitset, p )
+                 == obj.getNeighborhoodConfigurationOccupancy( p, *mapZeroNeighborhoodToMask ) );
+        }
+    }
+}
+
+TEST_CASE( "Batched isSimple with tables", "[simple][object][bitset][3D]" )
+{
+  using namespace Z3i;
+  using BitsetObject = Object< DT26_6, DigitalSetByBitset<Domain> >;
+  const Domain domain( Point( 0, 0, 0 ), Point( 20, 15, 12 ) );
+  DigitalSet set( domain );
+  DigitalSetByBitset<Domain> bitset( domain );
+  randomSets( domain, set, bitset, 0.6 );
+  auto ptable = loadTable( simplicity::tableSimple26_6 );
+
+  Object26_6 obj( dt26_6, set );
+  BitsetObject bobj( dt26_6, bitset );
+  bobj.setTable( ptable );
+  std::vector<bool> simple, simpleTable;
+  obj.isSimple( set.begin(), set.end(), std::back_inserter( simple ) );
+  bobj.isSimple( set.begin(), set.end(), std::back_inserter( simpleTable ), 3 );
+  REQUIRE( simple.size() == set.size() );
+  CHECK( simple == simpleTable );
+  std::size_t i = 0;
+  for ( const auto & p : set )
+    CHECK( bobj.isSimple( p ) == simple[ i++ ] );
+}
+
 SCENARIO( "Load isthmus tables", "[isthmus]" ){
   SECTION("isthmus"){
     const auto & filename = isthmusicity::tableIsthmus;
@@ -0,0 +1,213 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Functions for testing classes KhalimskyCellPacker and PackedCellSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellPacker.h"
+#include "DGtal/topology/PackedCellSet.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/Shapes.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+using namespace std;
+
+/// Random signed cell of the space K.
+template <typename KSpace>
+static typename KSpace::SCell randomSCell( const KSpace & K )
+{
+  typename KSpace::Point kp;
+  for ( Dimension k = 0; k < KSpace::dimension; ++k )
+    {
+      const int lo = 2 * K.lowerBound()[ k ] + ( K.isSpaceClosed( k ) ? 0 : 1 );
+      const int hi = 2 * K.upperBound()[ k ] + ( K.isSpaceClosed( k ) ? 2 : 1 );
+      kp[ k ] = lo + rand() % ( hi - lo + 1 );
+    }
+  return K.sCell( kp, rand() % 2 == 0 );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Test cases
+
+TEMPLATE_TEST_CASE( "KhalimskyCellPacker operations agree with the space",
+                    "[packer]", Z2i::KSpace, Z3i::KSpace )
+{
+  typedef TestType          KSpace;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef KhalimskyCellPacker<KSpace> Packer;
+  srand( 0 );
+  for ( bool closed : { true, false } )
+    {
+      KSpace K;
+      K.init( Point::diagonal( -11 ), Point::diagonal( 17 ), closed );
+      REQUIRE( Packer::canPack( K ) );
+      Packer P( K );
+      REQUIRE( P.isValid() );
+      for ( int i = 0; i < 2000; ++i )
+        {
+          const SCell c = randomSCell( K );
+          const auto  p = P.sPack( c );
+          REQUIRE( P.sUnpack( p ) == c );
+          REQUIRE( P.uUnpack( P.unsigns( p ) ) == K.unsigns( c ) );
+          REQUIRE( P.uPack( K.unsigns( c ) ) == P.unsigns( p ) );
+          REQUIRE( P.uDim( p ) == K.sDim( c ) );
+          REQUIRE( P.sSign( p ) == K.sSign( c ) );
+          REQUIRE( P.sUnpack( P.sOpp( p ) ) == K.sOpp( c ) );
+          if ( K.sIsSurfel( c ) )
+            REQUIRE( P.sOrthDir( p ) == K.sOrthDir( c ) );
+          for ( Dimension k = 0; k < KSpace::dimension; ++k )
+            {
+              REQUIRE( P.uKCoord( p, k ) == K.sKCoord( c, k ) );
+              REQUIRE( P.uIsOpen( p, k ) == K.sIsOpen( c, k ) );
+              REQUIRE( P.sDirect( p, k ) == K.sDirect( c, k ) );
+              // Incident cells stay in the space except on an open border.
+              const bool inside = closed
+                || ( K.sKCoord( c, k ) > 2 * K.lowerBound()[ k ] + 1
+                     && K.sKCoord( c, k ) < 2 * K.upperBound()[ k ] + 1 );
+              if ( K.sIsOpen( c, k ) && inside )
+                {
+                  REQUIRE( P.sUnpack( P.sIncident( p, k, true ) )
+                           == K.sIncident( c, k, true ) );
+                  REQUIRE( P.sUnpack( P.sIncident( p, k, false ) )
+                           == K.sIncident( c, k, false ) );
+                  REQUIRE( P.sUnpack( P.sDirectIncident( p, k ) )
+                           == K.sDirectIncident( c, k ) );
+                  REQUIRE( P.sUnpack( P.sIndirectIncident( p, k ) )
+                           == K.sIndirectIncident( c, k ) );
+                }
+              if ( ! K.sIsMax( c, k ) )
+                REQUIRE( P.sUnpack( P.sAdjacent( p, k, true ) )
+                         == K.sAdjacent( c, k, true ) );
+              if ( ! K.sIsMin( c, k ) )
+                REQUIRE( P.sUnpack( P.sAdjacent( p, k, false ) )
+                         == K.sAdjacent( c, k, false ) );
+            }
+        }
+    }
+}
+
+TEST_CASE( "KhalimskyCellPacker limits" )
+{
+  Z3i::KSpace K;
+  K.init( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 1 << 19 ), true );
+  REQUIRE( ! KhalimskyCellPacker<Z3i::KSpace>::canPack( K ) );
+  K.init( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( ( 1 << 19 ) - 2 ), true );
+  REQUIRE( KhalimskyCellPacker<Z3i::KSpace>::canPack( K ) );
+  K.init( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 10 ), Z3i::KSpace::PERIODIC );
+  REQUIRE( ! KhalimskyCellPacker<Z3i::KSpace>::canPack( K ) );
+}
+
+TEST_CASE( "PackedCellSet behaves as std::set" )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::SCell SCell;
+  typedef KSpace::Cell  Cell;
+  srand( 0 );
+  KSpace K;
+  K.init( Z3i::Point::diagonal( -6 ), Z3i::Point::diagonal( 5 ), true );
+
+  SECTION( "Signed cells" )
+    {
+      PackedCellSet<KSpace> S( K );
+      std::set<SCell> R;
+      for ( int i = 0; i < 5000; ++i )
+        {
+          const SCell c = randomSCell( K );
+          REQUIRE( S.insert( c ).second == R.insert( c ).second );
+        }
+      REQUIRE( S.isValid() );
+      REQUIRE( S.size() == R.size() );
+      for ( int i = 0; i < 3000; ++i )
+        {
+          const SCell c = randomSCell( K );
+          REQUIRE( S.count( c ) == R.count( c ) );
+          REQUIRE( ( S.find( c ) == S.end() ) == ( R.find( c ) == R.end() ) );
+          if ( i % 2 == 0 ) REQUIRE( S.erase( c ) == R.erase( c ) );
+        }
+      REQUIRE( S.isValid() );
+      REQUIRE( S.size() == R.size() );
+      std::set<SCell> T( S.begin(), S.end() );
+      REQUIRE( T == R );
+      PackedCellSet<KSpace> S2( K, R.begin(), R.end() );
+      REQUIRE( S2 == S );
+    }
+
+  SECTION( "Unsigned cells" )
+    {
+      PackedCellSet<KSpace, Cell> S( K );
+      std::set<Cell> R;
+      for ( int i = 0; i < 5000; ++i )
+        {
+          const Cell c = K.unsigns( randomSCell( K ) );
+          REQUIRE( S.insert( c ).second == R.insert( c ).second );
+        }
+      REQUIRE( S.size() == R.size() );
+      std::set<Cell> T( S.begin(), S.end() );
+      REQUIRE( T == R );
+    }
+}
+
+TEST_CASE( "PackedCellSet as surfel set of a DigitalSurface" )
+{
+  using namespace Z3i;
+  typedef PackedCellSet<KSpace>               SurfelSet;
+  typedef SetOfSurfels<KSpace, SurfelSet>     PackedContainer;
+  typedef SetOfSurfels<KSpace>                Container;
+  Point p1( -10, -10, -10 ), p2( 10, 10, 10 );
+  KSpace K; K.init( p1, p2, true );
+  DigitalSet aSet( Domain( p1, p2 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 6 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 4, 3, 2 ), 5 );
+  SurfelAdjacency<3> SAdj( true );
+
+  SurfelSet packed( K );
+  KSpace::SurfelSet surfels;
+  Surfaces<KSpace>::sMakeBoundary( packed, K, aSet, p1, p2 );
+  Surfaces<KSpace>::sMakeBoundary( surfels, K, aSet, p1, p2 );
+  REQUIRE( packed.size() == surfels.size() );
+
+  DigitalSurface<PackedContainer> S1( new PackedContainer( K, SAdj, packed ) );
+  DigitalSurface<Container>       S2( new Container( K, SAdj, surfels ) );
+  REQUIRE( S1.size() == S2.size() );
+  for ( auto s : S1 ) REQUIRE( surfels.count( s ) == 1 );
+  std::size_t deg1 = 0, deg2 = 0;
+  for ( auto s : S1 ) deg1 += S1.degree( s );
+  for ( auto s : S2 ) deg2 += S2.degree( s );
+  REQUIRE( deg1 == deg2 );
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
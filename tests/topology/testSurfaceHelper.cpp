@@ -316,6 +316,120 @@ bool testFindABel()
 }
 
 
+/**
+ * Checks that Surfaces::sMakeSortedBoundary and
+ * Surfaces::uMakeSortedBoundary give the same surfels, in the same
+ * order, as sMakeBoundary and uMakeBoundary with std::set, for
+ * several numbers of threads.
+ */
+template <typename KSpace>
+bool testSortedBoundary()
+{
+  typedef typename KSpace::Space     Space;
+  typedef typename KSpace::Point     Point;
+  typedef typename KSpace::Cell      Cell;
+  typedef typename KSpace::SCell     SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sMakeSortedBoundary in dimension "
+                     + std::to_string( KSpace::dimension ) );
+  const Point p1 = Point::diagonal( -7 );
+  const Point p2 = Point::diagonal(  6 );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point::diagonal( -2 ), 4 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point::diagonal( 3 ), 3 );
+  // touches the domain border
+  aSet.insert( p1 );
+  for ( bool closed : { true, false } )
+    {
+      KSpace K; K.init( p1, p2, closed );
+      std::set<SCell> sref;
+      std::set<Cell>  uref;
+      Surfaces<KSpace>::sMakeBoundary( sref, K, aSet, p1, p2 );
+      Surfaces<KSpace>::uMakeBoundary( uref, K, aSet, p1, p2 );
+      for ( unsigned int nbThreads : { 1u, 3u, 0u } )
+        {
+          std::vector<SCell> sbdry;
+          std::vector<Cell>  ubdry;
+          Surfaces<KSpace>::sMakeSortedBoundary( sbdry, K, aSet, p1, p2, nbThreads );
+          Surfaces<KSpace>::uMakeSortedBoundary( ubdry, K, aSet, p1, p2, nbThreads );
+          ++nb; nbok += ( sbdry.size() == sref.size()
+                          && std::equal( sbdry.begin(), sbdry.end(), sref.begin() ) )
+                  ? 1 : 0;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << sbdry.size() << " signed surfels, expected "
+                       << sref.size() << " (nbThreads=" << nbThreads << ")" << std::endl;
+          ++nb; nbok += ( ubdry.size() == uref.size()
+                          && std::equal( ubdry.begin(), ubdry.end(), uref.begin() ) )
+                  ? 1 : 0;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << ubdry.size() << " unsigned surfels, expected "
+                       << uref.size() << " (nbThreads=" << nbThreads << ")" << std::endl;
+        }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
+/**
+ * Checks that Surfaces::trackBoundaryWithBitmaps gives the same
+ * surfels as trackBoundary and trackClosedBoundary, for both surfel
+ * adjacencies and several numbers of threads, including on a shape
+ * touching the bounds of the space.
+ */
+bool testTrackBoundaryWithBitmaps()
+{
+  typedef KhalimskySpaceND<3,int>    KSpace;
+  typedef KSpace::Space              Space;
+  typedef KSpace::Point              Point;
+  typedef KSpace::SCell              SCell;
+  typedef HyperRectDomain<Space>     Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::trackBoundaryWithBitmaps" );
+  const Point p1( -8, -6, -7 );
+  const Point p2(  7,  6,  9 );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -1, 0, 0 ), 5 );
+  Shapes<Domain>::addNorm1Ball( aSet, Point( 3, 2, 4 ), 4 );
+  // touches the space border
+  for ( int x = 0; x <= 7; ++x ) aSet.insert( Point( x, 0, 0 ) );
+  for ( bool closed : { true, false } )
+    for ( bool interior : { true, false } )
+      {
+        KSpace K; K.init( p1, p2, true );
+        SurfelAdjacency<3> SAdj( interior );
+        const SCell bel = Surfaces<KSpace>::findABel( K, aSet, 10000 );
+        std::set<SCell> ref;
+        if ( closed )
+          Surfaces<KSpace>::trackClosedBoundary( ref, K, SAdj, aSet, bel );
+        else
+          Surfaces<KSpace>::trackBoundary( ref, K, SAdj, aSet, bel );
+        for ( unsigned int nbThreads : { 1u, 3u } )
+          {
+            std::vector<SCell> surface;
+            Surfaces<KSpace>::trackBoundaryWithBitmaps
+              ( surface, K, SAdj, aSet, bel, closed, nbThreads );
+            ++nb; nbok += ( surface.size() == ref.size()
+                            && std::equal( surface.begin(), surface.end(), ref.begin() ) )
+                    ? 1 : 0;
+            trace.info() << "(" << nbok << "/" << nb << ") "
+                         << surface.size() << " surfels, expected " << ref.size()
+                         << " (closed=" << closed << ", interior=" << interior
+                         << ", nbThreads=" << nbThreads << ")" << std::endl;
+          }
+      }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -328,7 +442,10 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testSortedBoundary< KhalimskySpaceND<2,int> >()
+    && testSortedBoundary< KhalimskySpaceND<3,int> >()
+    && testTrackBoundaryWithBitmaps();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
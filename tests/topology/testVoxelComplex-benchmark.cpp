@@ -0,0 +1,123 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoxelComplex-benchmark.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2026/10/16
+ *
+ * Benchmark of the thinning schemes of VoxelComplexFunctions.h: the
+ * asymetric thinning scheme against the thinning by independent
+ * subfields, on a solid torus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cmath>
+#include <iostream>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/VoxelComplexFunctions.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+#include "DGtal/topology/tables/NeighborhoodTables.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+typedef std::unordered_map<KSpace::Cell, CubicalCellData> CellMap;
+typedef VoxelComplex<KSpace, CellMap> Complex;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the thinning schemes.
+///////////////////////////////////////////////////////////////////////////////
+bool benchmarkThinning( int R, int r )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Domain domain( Point::diagonal( -R - r - 1 ), Point::diagonal( R + r + 1 ) );
+  DigitalSet torus( domain );
+  for ( auto p : domain )
+    {
+      const double d = std::sqrt( double( p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] ) ) - R;
+      if ( d * d + p[ 2 ] * p[ 2 ] <= r * r )
+        torus.insertNew( p );
+    }
+  KSpace ks;
+  ks.init( domain.lowerBound(), domain.upperBound(), true );
+  Complex vc( ks );
+  vc.construct( torus );
+  vc.setSimplicityTable( functions::loadTable( simplicity::tableSimple26_6 ) );
+  trace.info() << "Torus R=" << R << " r=" << r
+               << " voxels=" << vc.nbCells( 3 ) << std::endl;
+
+  trace.beginBlock( "asymetricThinningScheme" );
+  auto vc_asym = functions::asymetricThinningScheme< Complex >(
+    vc, functions::selectFirst< Complex >, functions::skelEnd< Complex > );
+  trace.info() << "voxels=" << vc_asym.nbCells( 3 ) << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "subfieldThinningScheme, 1 thread" );
+  auto vc_sub = functions::subfieldThinningScheme< Complex >(
+    vc, functions::skelEnd< Complex >, 1 );
+  trace.info() << "voxels=" << vc_sub.nbCells( 3 ) << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "subfieldThinningScheme, all threads" );
+  auto vc_par = functions::subfieldThinningScheme< Complex >(
+    vc, functions::skelEnd< Complex > );
+  trace.info() << "voxels=" << vc_par.nbCells( 3 ) << std::endl;
+  trace.endBlock();
+
+  // a torus has the homotopy type of a circle.
+  nbok += vc_asym.euler() == 0 ? 1 : 0;
+  nb++;
+  nbok += vc_sub.euler() == 0 ? 1 : 0;
+  nb++;
+  nbok += vc_par.nbCells( 3 ) == vc_sub.nbCells( 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same topology and same result whatever the number of threads"
+               << std::endl;
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking thinning schemes of VoxelComplex" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkThinning( 12, 5 ) && benchmarkThinning( 24, 10 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
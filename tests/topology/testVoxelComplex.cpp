@@ -806,6 +806,30 @@ TEST_CASE_METHOD(Fixture_isthmus, "Thin complex", "[isthmus][thin][function]") {
         CHECK(vc_new.nbCells(3) == 3);
     }
 }
+TEST_CASE_METHOD(Fixture_isthmus, "Subfield thin",
+                 "[isthmus][subfield][thin][function]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    SECTION("with skelUltimate") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelUltimate<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) == 1);
+    }
+    SECTION("with skelUltimate on a disconnected complex") {
+        set_fixture.erase(Point(-1, 4, 0));
+        vc.clear();
+        vc.construct(set_fixture);
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelUltimate<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) == 2);
+    }
+    SECTION("with skelEnd") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelEnd<FixtureComplex>);
+        CHECK(vc_new.nbCells(3) > 1);
+        CHECK(vc_new.euler() == vc.euler());
+    }
+}
 //
 TEST_CASE_METHOD(Fixture_isthmus, "Persistence thin",
                  "[persistence][isthmus][thin][function]") {
@@ -1055,6 +1079,43 @@ TEST_CASE_METHOD(Fixture_X, "X Thin with Isthmus, and tables",
     }
 }
 
+TEST_CASE_METHOD(Fixture_X, "X Subfield Thin",
+                 "[x][subfield][thin][function][table]") {
+    using namespace DGtal::functions;
+    auto &vc = complex_fixture;
+    vc.setSimplicityTable(functions::loadTable(simplicity::tableSimple26_6));
+    SECTION("with skelUltimate") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelUltimate<FixtureComplex>, 1);
+        CHECK(vc_new.nbCells(3) == 1);
+        CHECK(vc_new.isTableLoaded());
+        CHECK(vc_new.euler() == 1);
+    }
+    SECTION("with skelEnd, whatever the number of threads") {
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc, skelEnd<FixtureComplex>, 1);
+        auto vc_parallel = subfieldThinningScheme<FixtureComplex>(
+            vc, skelEnd<FixtureComplex>, 4);
+        CHECK(vc_new.nbCells(3) > 1);
+        CHECK(vc_new.nbCells(3) < vc.nbCells(3));
+        CHECK(vc_new.euler() == vc.euler());
+        REQUIRE(vc_parallel.nbCells(3) == vc_new.nbCells(3));
+        for (auto it = vc_new.begin(3), itE = vc_new.end(3); it != itE; ++it)
+            CHECK(vc_parallel.findCell(3, it->first) != vc_parallel.end(3));
+        // The remaining voxels are closed.
+        CHECK(vc_new.nbCells(0) > vc_new.nbCells(3));
+    }
+    SECTION("without table, same as with table") {
+        auto vc_table = subfieldThinningScheme<FixtureComplex>(
+            vc, skelEnd<FixtureComplex>, 2);
+        FixtureComplex vc_no_table(vc.space());
+        vc_no_table.construct(set_fixture);
+        auto vc_new = subfieldThinningScheme<FixtureComplex>(
+            vc_no_table, skelEnd<FixtureComplex>, 2);
+        CHECK(vc_new.nbCells(3) == vc_table.nbCells(3));
+    }
+}
+
 /// Use distance map in the Select function.
 TEST_CASE_METHOD(Fixture_X, "X DistanceMap", "[x][distance][thin]") {
     using namespace DGtal::functions;